@@ -0,0 +1,58 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+cmake_minimum_required(VERSION 3.19)
+
+#
+# add_pch_library(<target> <pch_bundle> [DEFINITIONS <definition>...])
+#
+# Creates an object library that precompiles the headers of `pch_bundle` (i.e. `mp-units::si-pch`)
+# only once so they can be shared by many targets with `target_reuse_pch()`. This is much faster
+# than linking `pch_bundle` to every single-file target which would precompile the same headers
+# for each of them.
+#
+# The precompiled header can be used only if the compile definitions of its consumers are
+# the same as the ones used to build it, which is why `DEFINITIONS` are propagated to them.
+#
+function(add_pch_library target pch_bundle)
+    cmake_parse_arguments(PARSE_ARGV 2 ARG "" "" "DEFINITIONS")
+
+    set(source "${CMAKE_CURRENT_BINARY_DIR}/${target}.cpp")
+    file(CONFIGURE OUTPUT "${source}" CONTENT "// precompiled headers of ${pch_bundle}\n")
+
+    add_library(${target} OBJECT "${source}")
+    target_link_libraries(${target} PUBLIC ${pch_bundle})
+    if(ARG_DEFINITIONS)
+        target_compile_definitions(${target} PUBLIC ${ARG_DEFINITIONS})
+    endif()
+endfunction()
+
+#
+# target_reuse_pch(<target> <pch_library>)
+#
+# Builds `target` with the precompiled headers of `pch_library` created with `add_pch_library()`.
+#
+function(target_reuse_pch target pch_library)
+    target_link_libraries(${target} PRIVATE ${pch_library})
+    target_precompile_headers(${target} REUSE_FROM ${pch_library})
+endfunction()
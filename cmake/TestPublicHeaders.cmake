@@ -59,9 +59,15 @@ endfunction()
 
 include(TestHeaders)
 
+#
+# add_public_header_test(<target> <test_target> [EXCLUDE_FROM_ALL] [EXCLUDE excludes...])
+#
+# Generates header-inclusion unit tests for all the headers of `test_target`
+# and its dependencies. Remaining arguments are forwarded to `add_header_test`.
+#
 function(add_public_header_test target test_target)
     get_target_sources(${test_target} sources)
-    add_header_test(${target} HEADERS ${sources})
+    add_header_test(${target} ${ARGN} HEADERS ${sources})
     target_link_libraries(${target} PRIVATE ${test_target})
     target_include_directories(${target} PRIVATE .)
 endfunction()
@@ -0,0 +1,71 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+cmake_minimum_required(VERSION 3.19)
+
+#
+# add_time_trace_report(<target> <traced_target> [TOP n] [BASELINE path [THRESHOLD percent]])
+#
+# Enables Clang's `-ftime-trace` for all the translation units of `traced_target`
+# and creates a `target` that aggregates the produced traces into a ranked report
+# of template instantiations and per-translation-unit frontend times.
+#
+# The report is written to `${CMAKE_CURRENT_BINARY_DIR}/<target>.md` and
+# `${CMAKE_CURRENT_BINARY_DIR}/<target>.json`. The JSON file may be provided as a
+# `BASELINE` of a later run to print per-translation-unit differences. With a `THRESHOLD`
+# the target fails if the frontend time of any translation unit grew by more than the
+# given percentage of the baseline.
+#
+function(add_time_trace_report target traced_target)
+    cmake_parse_arguments(PARSE_ARGV 2 ARG "" "TOP;BASELINE;THRESHOLD" "")
+
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        message(WARNING "'${target}' requires Clang (${CMAKE_CXX_COMPILER_ID} in use) - the target will not be created")
+        return()
+    endif()
+
+    find_package(Python3 COMPONENTS Interpreter REQUIRED)
+
+    if(NOT ARG_TOP)
+        set(ARG_TOP 50)
+    endif()
+    if(ARG_BASELINE)
+        set(baseline_args --baseline "${ARG_BASELINE}")
+        if(ARG_THRESHOLD)
+            list(APPEND baseline_args --threshold ${ARG_THRESHOLD})
+        endif()
+    endif()
+
+    target_compile_options(${traced_target} PRIVATE -ftime-trace)
+
+    add_custom_target(
+        ${target}
+        COMMAND
+            "${Python3_EXECUTABLE}" "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/time_trace_report.py"
+            "${CMAKE_CURRENT_BINARY_DIR}/CMakeFiles/${traced_target}.dir" --top ${ARG_TOP} --markdown
+            "${CMAKE_CURRENT_BINARY_DIR}/${target}.md" --json "${CMAKE_CURRENT_BINARY_DIR}/${target}.json" ${baseline_args}
+        DEPENDS ${traced_target}
+        COMMENT "Aggregating compile-time traces of '${traced_target}'"
+        VERBATIM
+    )
+endfunction()
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Aggregates Clang `-ftime-trace` files into a ranked compile-time report.
+
+Every translation unit compiled with `-ftime-trace` produces a JSON file next to its
+object file. This script collects all of them from a build directory and reports:
+- the frontend time of each translation unit (e.g. each standalone public header),
+- the templates that took the most time to instantiate summed over all translation
+  units (all the specializations of a template are accounted under its name).
+
+Instantiation times are inclusive (nested instantiations are also accounted in
+their parents), so they should be used for ranking rather than summed up.
+"""
+
+import argparse
+import json
+import os
+import sys
+from collections import defaultdict
+
+INSTANTIATION_EVENTS = ("InstantiateClass", "InstantiateFunction")
+FRONTEND_EVENT = "Total Frontend"
+BACKEND_EVENT = "Total Backend"
+
+
+def template_name(detail):
+    """Strips the template arguments from an instantiation description.
+
+    `units::detail::downcast_impl<units::...>` -> `units::detail::downcast_impl`
+    """
+    begin = 0
+    while True:
+        pos = detail.find("<", begin)
+        if pos == -1:
+            return detail
+        # do not split `operator<`, `operator<<`, and `operator<=>`
+        if detail.endswith("operator", 0, pos):
+            for op in ("<=>", "<<", "<"):
+                if detail.startswith(op, pos):
+                    begin = pos + len(op)
+                    break
+            continue
+        return detail[:pos]
+
+
+def find_traces(directory):
+    for root, _, files in os.walk(directory):
+        for file in files:
+            # Clang names a trace after the object file (`foo.cpp.o` -> `foo.cpp.json`)
+            if file.endswith(".json") and os.path.splitext(file)[0].endswith((".cpp", ".cc", ".cxx")):
+                yield os.path.join(root, file)
+
+
+def parse_trace(path):
+    with open(path, encoding="utf-8") as f:
+        events = json.load(f).get("traceEvents", [])
+
+    times = {"frontend": 0.0, "backend": 0.0}
+    templates = defaultdict(lambda: {"count": 0, "time": 0.0})
+    for event in events:
+        name = event.get("name")
+        # durations are reported in microseconds
+        duration = event.get("dur", 0) / 1000.0
+        if name in INSTANTIATION_EVENTS:
+            entry = templates[template_name(event.get("args", {}).get("detail", "<unknown>"))]
+            entry["count"] += 1
+            entry["time"] += duration
+        elif name == FRONTEND_EVENT:
+            times["frontend"] = duration
+        elif name == BACKEND_EVENT:
+            times["backend"] = duration
+    return times, templates
+
+
+def aggregate(directory):
+    units = {}
+    templates = defaultdict(lambda: {"count": 0, "time": 0.0, "units": 0})
+    for path in sorted(find_traces(directory)):
+        tu = os.path.relpath(path, directory)[: -len(".json")]
+        times, tu_templates = parse_trace(path)
+        units[tu] = times
+        for name, entry in tu_templates.items():
+            total = templates[name]
+            total["count"] += entry["count"]
+            total["time"] += entry["time"]
+            total["units"] += 1
+    return units, templates
+
+
+def load_baseline(path):
+    if not path:
+        return {}
+    with open(path, encoding="utf-8") as f:
+        return json.load(f).get("translation_units", {})
+
+
+def find_regressions(units, baseline, threshold, min_delta):
+    """Returns the translation units whose frontend time grew over `threshold` percent of the baseline.
+
+    Growths smaller than `min_delta` milliseconds are ignored as they are within the noise of CI runners.
+    """
+    regressions = {}
+    for tu, times in units.items():
+        old = baseline.get(tu, {}).get("frontend")
+        if not old:
+            continue
+        delta = times["frontend"] - old
+        if delta >= min_delta and delta / old * 100 > threshold:
+            regressions[tu] = delta / old * 100
+    return regressions
+
+
+def write_markdown(path, units, templates, top, baseline, regressions):
+    ranked_units = sorted(units.items(), key=lambda kv: kv[1]["frontend"], reverse=True)
+    ranked_templates = sorted(templates.items(), key=lambda kv: kv[1]["time"], reverse=True)[:top]
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("# Compile-time report\n\n")
+        f.write(f"- Translation units: {len(units)}\n")
+        f.write(f"- Total frontend time: {sum(u['frontend'] for u in units.values()):.0f} ms\n\n")
+
+        if regressions:
+            f.write(f"## Regressions ({len(regressions)})\n\n")
+            for tu, change in sorted(regressions.items(), key=lambda kv: kv[1], reverse=True):
+                f.write(f"- `{tu}`: {change:+.1f}%\n")
+            f.write("\n")
+
+        f.write(f"## Top {len(ranked_templates)} template instantiations (inclusive time)\n\n")
+        f.write("| # | Template | Total [ms] | Instantiations | Translation units |\n")
+        f.write("|--:|----------|-----------:|---------------:|------------------:|\n")
+        for i, (name, entry) in enumerate(ranked_templates, 1):
+            f.write(f"| {i} | `{name}` | {entry['time']:.1f} | {entry['count']} | {entry['units']} |\n")
+
+        f.write("\n## Translation units\n\n")
+        if baseline:
+            f.write("| Translation unit | Frontend [ms] | Backend [ms] | Baseline [ms] | Change |\n")
+            f.write("|------------------|--------------:|-------------:|--------------:|-------:|\n")
+        else:
+            f.write("| Translation unit | Frontend [ms] | Backend [ms] |\n")
+            f.write("|------------------|--------------:|-------------:|\n")
+        for tu, times in ranked_units:
+            row = f"| `{tu}` | {times['frontend']:.1f} | {times['backend']:.1f} |"
+            if baseline:
+                old = baseline.get(tu, {}).get("frontend")
+                if old:
+                    mark = " :x:" if tu in regressions else ""
+                    row += f" {old:.1f} | {(times['frontend'] - old) / old * 100:+.1f}%{mark} |"
+                else:
+                    row += " - | new |"
+            f.write(row + "\n")
+
+
+def write_json(path, units, templates):
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump({"translation_units": units, "templates": templates}, f, indent=2, sort_keys=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("directory", help="directory searched recursively for `-ftime-trace` files")
+    parser.add_argument("--top", type=int, default=50, help="number of template instantiations to report")
+    parser.add_argument("--markdown", help="path of the Markdown report to generate")
+    parser.add_argument("--json", help="path of the JSON report to generate (usable as a baseline)")
+    parser.add_argument("--baseline", help="JSON report of an earlier run to compare against")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        help="fail if the frontend time of any translation unit grew by more than this percentage of the baseline",
+    )
+    parser.add_argument(
+        "--min-delta",
+        type=float,
+        default=50.0,
+        help="growth in milliseconds below which a translation unit is never reported as a regression",
+    )
+    args = parser.parse_args()
+
+    units, templates = aggregate(args.directory)
+    if not units:
+        print(f"No time-trace files found in '{args.directory}'", file=sys.stderr)
+        return 1
+
+    baseline = load_baseline(args.baseline)
+    regressions = {}
+    if args.threshold is not None:
+        regressions = find_regressions(units, baseline, args.threshold, args.min_delta)
+    if args.markdown:
+        write_markdown(args.markdown, units, templates, args.top, baseline, regressions)
+        print(f"Compile-time report written to '{args.markdown}'")
+    if args.json:
+        write_json(args.json, units, templates)
+
+    if regressions:
+        for tu, change in sorted(regressions.items(), key=lambda kv: kv[1], reverse=True):
+            print(f"'{tu}' frontend time grew by {change:+.1f}% (threshold: {args.threshold}%)", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
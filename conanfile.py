@@ -84,6 +84,14 @@ class MPUnitsConan(ConanFile):
     def _skip_la(self):
         return bool(self.conf.get("user.build:skip_la", default=False))
 
+    @property
+    def _build_si_instantiations(self):
+        return bool(self.conf.get("user.build:si_instantiations", default=False))
+
+    @property
+    def _build_pch(self):
+        return bool(self.conf.get("user.build:pch", default=False))
+
     @property
     def _skip_docs(self):
         return bool(self.conf.get("user.build:skip_docs", default=False))
@@ -146,6 +154,8 @@ class MPUnitsConan(ConanFile):
         tc = CMakeToolchain(self)
         tc.variables["UNITS_DOWNCAST_MODE"] = str(self.options.downcast_mode).upper()
         tc.variables["UNITS_BUILD_LA"] = self._build_all and not self._skip_la
+        tc.variables["UNITS_BUILD_SI_INSTANTIATIONS"] = self._build_all and self._build_si_instantiations
+        tc.variables["UNITS_PCH"] = self._build_all and self._build_pch
         tc.variables["UNITS_BUILD_DOCS"] = self._build_all and not self._skip_docs
         tc.variables["UNITS_USE_LIBFMT"] = self._use_libfmt
         tc.generate()
@@ -172,6 +182,12 @@ class MPUnitsConan(ConanFile):
         cmake = CMake(self)
         cmake.install()
         rmdir(self, os.path.join(self.package_folder, "lib", "cmake"))
+        copy(
+            self,
+            "mp-units-pch.cmake",
+            os.path.join(self.source_folder, "src", "cmake"),
+            os.path.join(self.package_folder, "lib", "cmake"),
+        )
 
     def package_info(self):
         compiler = self.settings.compiler
@@ -214,3 +230,9 @@ class MPUnitsConan(ConanFile):
             "si-uscs",
             "isq-iec80000",
         ]
+
+        # precompiled headers bundles
+        self.cpp_info.components["si-pch"].requires = ["core", "core-io", "si"]
+        self.cpp_info.components["si-fmt-pch"].requires = ["si-pch", "core-fmt"]
+        self.cpp_info.components["iec80000-pch"].requires = ["core", "core-io", "isq-iec80000"]
+        self.cpp_info.set_property("cmake_build_modules", [os.path.join("lib", "cmake", "mp-units-pch.cmake")])
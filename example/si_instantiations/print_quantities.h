@@ -0,0 +1,92 @@
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// The same translation units are compiled twice: with `SI_INSTANTIATIONS_EXTERN` defined they rely on
+// the instantiations from `mp-units::si-instantiations`, otherwise they instantiate all of them on their own.
+#ifdef SI_INSTANTIATIONS_EXTERN
+#include <units/isq/si/extern_templates.h>
+#else
+#include <units/format.h>
+#include <units/isq/si/acceleration.h>
+#include <units/isq/si/area.h>
+#include <units/isq/si/energy.h>
+#include <units/isq/si/force.h>
+#include <units/isq/si/frequency.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/mass.h>
+#include <units/isq/si/power.h>
+#include <units/isq/si/pressure.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/thermodynamic_temperature.h>
+#include <units/isq/si/time.h>
+#include <units/isq/si/volume.h>
+#include <units/quantity_io.h>
+#endif
+
+#include <ostream>
+
+namespace si_instantiations_example {
+
+template<typename Q>
+void print(std::ostream& os, const Q& q)
+{
+  os << q << " | " << UNITS_STD_FMT::format("{:%.3Q %q}", q) << '\n';
+}
+
+/**
+ * @brief Streams and formats 14 of the quantities instantiated in `mp-units::si-instantiations`
+ *
+ * Every translation unit uses a different `Id` so that only the quantities themselves are shared
+ * between them.
+ */
+template<int Id>
+void print_quantities(std::ostream& os, double value)
+{
+  namespace si = units::isq::si;
+
+  os << "--- report " << Id << " ---\n";
+  print(os, si::length<si::metre>(value));
+  print(os, si::length<si::kilometre>(value));
+  print(os, si::time<si::second>(value));
+  print(os, si::time<si::hour>(value));
+  print(os, si::mass<si::kilogram>(value));
+  print(os, si::thermodynamic_temperature<si::kelvin>(value));
+  print(os, si::area<si::square_metre>(value));
+  print(os, si::volume<si::cubic_metre>(value));
+  print(os, si::frequency<si::hertz>(value));
+  print(os, si::speed<si::metre_per_second>(value));
+  print(os, si::speed<si::kilometre_per_hour>(value));
+  print(os, si::acceleration<si::metre_per_second_sq>(value));
+  print(os, si::force<si::newton>(value));
+  print(os, si::energy<si::joule>(value));
+}
+
+void report_1(std::ostream& os);
+void report_2(std::ostream& os);
+void report_3(std::ostream& os);
+void report_4(std::ostream& os);
+void report_5(std::ostream& os);
+
+}  // namespace si_instantiations_example
@@ -67,3 +67,30 @@ function(add_units_module name)
     install(TARGETS mp-units-${name} EXPORT mp-unitsTargets)
     install(DIRECTORY include/units TYPE INCLUDE)
 endfunction()
+
+#
+# add_units_pch(BundleName
+#               DEPENDENCIES <depependency>...
+#               HEADERS <header_file>...)
+#
+# Defines `mp-units::<BundleName>-pch` target that links to the provided dependencies and
+# makes all of its consumers precompile the provided headers (e.g. `<units/isq/si/si.h>`).
+#
+function(add_units_pch name)
+    # parse arguments
+    set(multiValues DEPENDENCIES HEADERS)
+    cmake_parse_arguments(PARSE_ARGV 1 ARG "" "" "${multiValues}")
+
+    # validate and process arguments
+    validate_unparsed(${name}-pch ARG)
+    validate_arguments_exists(${name}-pch ARG DEPENDENCIES HEADERS)
+
+    # define the target for a precompiled headers bundle
+    add_library(mp-units-${name}-pch INTERFACE)
+    target_link_libraries(mp-units-${name}-pch INTERFACE ${ARG_DEPENDENCIES})
+    target_precompile_headers(mp-units-${name}-pch INTERFACE ${ARG_HEADERS})
+    set_target_properties(mp-units-${name}-pch PROPERTIES EXPORT_NAME ${name}-pch)
+    add_library(mp-units::${name}-pch ALIAS mp-units-${name}-pch)
+
+    install(TARGETS mp-units-${name}-pch EXPORT mp-unitsTargets)
+endfunction()
@@ -0,0 +1,45 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+# Headers of the precompiled headers bundles. This file is the only place where they are listed. It is
+# included by `src/CMakeLists.txt` before `add_units_pch()` calls and installed as a CMake build module of
+# the Conan package (Conan components cannot express precompiled headers) where it adds the headers
+# to the already imported `mp-units::*-pch` targets.
+
+#
+# Only the core class templates and the definitions of the systems are precompiled. Headers adding overloads
+# of free functions (e.g. `sin()` or `pow()` of `<units/math.h>` and `operator<<` of `<units/quantity_io.h>`)
+# are left out, as a precompiled header is visible in every translation unit and such overloads could change
+# the name lookup of the sources that do not include them.
+set(mp-units-si-pch-headers <units/quantity.h> <units/quantity_point.h> <units/isq/si/si.h>)
+set(mp-units-si-fmt-pch-headers <units/format.h>)
+set(mp-units-iec80000-pch-headers <units/quantity.h> <units/quantity_point.h> <units/isq/iec80000/iec80000.h>)
+
+foreach(bundle si si-fmt iec80000)
+    if(TARGET mp-units::${bundle}-pch)
+        set_property(
+            TARGET mp-units::${bundle}-pch APPEND PROPERTY INTERFACE_PRECOMPILE_HEADERS
+                                                           ${mp-units-${bundle}-pch-headers}
+        )
+    endif()
+endforeach()
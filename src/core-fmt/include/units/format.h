@@ -26,7 +26,9 @@
 #include <units/customization_points.h>
 #include <units/quantity.h>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <string>
 
 // IWYU pragma: begin_exports
 #include <units/bits/unit_text.h>
@@ -74,6 +76,15 @@
 //         UNITS_STD_FMT::formatter::spec_handler::on_unit_modifier member function)
 // -   Implement the effect of the new flag in the `quantity_formatter::on_quantity_unit` member function
 
+namespace units {
+
+// only declared (it is defined in `units/wide_int.h`) so that its formatter below does not need that header
+template<std::size_t N>
+  requires(N >= 128 && N % 64 == 0)
+class wide_int;
+
+}  // namespace units
+
 namespace units::detail {
 
 // Holds specs about the whole object
@@ -436,7 +447,7 @@ public:
   }
 
   template<typename FormatContext>
-  auto format(const quantity& q, FormatContext& ctx)
+  auto format(const quantity& q, FormatContext& ctx) -> decltype(ctx.out())
   {
     // process dynamic width and precision
     if (specs.global.dynamic_width_index >= 0)
@@ -470,3 +481,73 @@ public:
     }
   }
 };
+
+// supports the standard format specification of the integers:
+// [[fill] align] [sign] ['#'] ['0'] [width] ['L'] [type] with the type one of "bBdoxX" ('L' is accepted and ignored)
+template<std::size_t N, typename CharT>
+struct UNITS_STD_FMT::formatter<units::wide_int<N>, CharT> {
+private:
+  units::detail::dynamic_format_specs<CharT> specs;
+
+public:
+  constexpr auto parse(UNITS_STD_FMT::basic_format_parse_context<CharT>& ctx)
+  {
+    units::detail::dynamic_specs_handler handler(specs, ctx);
+    auto it = units::detail::parse_format_specs(ctx.begin(), ctx.end(), handler);
+    if (specs.precision >= 0 || specs.dynamic_precision_index >= 0)
+      UNITS_THROW(UNITS_STD_FMT::format_error("precision not allowed for wide_int"));
+    if (specs.type != '\0' && std::string_view{"bBdoxX"}.find(specs.type) == std::string_view::npos)
+      UNITS_THROW(UNITS_STD_FMT::format_error("invalid wide_int format"));
+    if (it != ctx.end() && *it != '}') UNITS_THROW(UNITS_STD_FMT::format_error("invalid wide_int format"));
+    return it;
+  }
+
+  template<typename FormatContext>
+  auto format(const units::wide_int<N>& v, FormatContext& ctx) -> decltype(ctx.out())
+  {
+    const char type = specs.type;
+    const int base = type == 'b' || type == 'B' ? 2 : type == 'o' ? 8 : type == 'x' || type == 'X' ? 16 : 10;
+    std::string digits = to_string(v, base);
+    const bool negative = digits.front() == '-';
+    if (negative) digits.erase(digits.begin());
+    if (type == 'X')
+      for (char& c : digits) c = c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+
+    std::string prefix;
+    if (negative)
+      prefix = "-";
+    else if (specs.sign == units::detail::fmt_sign::plus)
+      prefix = "+";
+    else if (specs.sign == units::detail::fmt_sign::space)
+      prefix = " ";
+    if (specs.alt && base != 10) prefix += base == 8 ? std::string("0") : std::string{'0', type};
+
+    int width = specs.width;
+    if (specs.dynamic_width_index >= 0)
+      width = units::detail::get_dynamic_spec<units::detail::width_checker>(specs.dynamic_width_index, ctx);
+    const auto size = static_cast<int>(prefix.size() + digits.size());
+    const std::size_t padding = width > size ? static_cast<std::size_t>(width - size) : 0;
+
+    // the '0' flag without an alignment pads with zeros after the sign and the base prefix
+    if (specs.align == units::detail::fmt_align::none && specs.fill[0] == CharT('0')) {
+      digits.insert(0, padding, '0');
+      auto out = ctx.out();
+      for (char c : prefix + digits) *out++ = static_cast<CharT>(c);
+      return out;
+    }
+
+    // numbers are aligned to the right by default
+    std::size_t before = padding;
+    if (specs.align == units::detail::fmt_align::left)
+      before = 0;
+    else if (specs.align == units::detail::fmt_align::center)
+      before = padding / 2;
+    const auto fill = [&](auto out, std::size_t count) {
+      for (std::size_t i = 0; i < count; ++i) out = std::copy_n(specs.fill.data(), specs.fill.size(), out);
+      return out;
+    };
+    auto out = fill(ctx.out(), before);
+    for (char c : prefix + digits) *out++ = static_cast<CharT>(c);
+    return fill(out, padding - before);
+  }
+};
@@ -23,7 +23,10 @@
 
 #pragma once
 
+#include <units/bits/int128.h>
 #include <units/quantity.h>
+#include <cstddef>
+#include <string>
 
 // IWYU pragma: begin_exports
 #include <units/bits/external/fixed_string_io.h>
@@ -35,10 +38,48 @@ namespace units {
 
 namespace detail {
 
+template<typename CharT, class Traits, typename T>
+  requires requires(std::basic_ostream<CharT, Traits>& os, const T& v) { os << v; }
+void number_to_stream(std::basic_ostream<CharT, Traits>& os, const T& v)
+{
+  os << v;
+}
+
+#if defined(__SIZEOF_INT128__)
+// the built-in 128-bit integers have no stream insertion operators
+template<typename CharT, class Traits, typename T>
+  requires std::same_as<T, int128_t> || std::same_as<T, uint128_t>
+void number_to_stream(std::basic_ostream<CharT, Traits>& os, const T& v)
+{
+  // printed like `wide_int` (honoring the `basefield`, `showbase`, `showpos`, and `uppercase` flags)
+  using ios = std::basic_ios<CharT, Traits>;
+  const auto flags = os.flags();
+  const auto basefield = flags & ios::basefield;
+  const unsigned base = basefield == ios::hex ? 16 : basefield == ios::oct ? 8 : 10;
+  const char* const digits = (flags & ios::uppercase) ? "0123456789ABCDEF" : "0123456789abcdef";
+  bool negative = false;
+  if constexpr (std::same_as<T, int128_t>) negative = v < 0;
+  uint128_t m = negative ? uint128_t{0} - static_cast<uint128_t>(v) : static_cast<uint128_t>(v);
+  std::string s;
+  do {
+    s.insert(s.begin(), digits[static_cast<std::size_t>(m % base)]);
+    m /= base;
+  } while (m != 0);
+  if ((flags & ios::showbase) && base != 10) s.insert(0, base == 8 ? "0" : (flags & ios::uppercase) ? "0X" : "0x");
+  if (negative)
+    s.insert(s.begin(), '-');
+  else if ((flags & ios::showpos) && base == 10)
+    s.insert(s.begin(), '+');
+  std::basic_string<CharT, Traits> out;
+  for (char c : s) out.push_back(os.widen(c));
+  os << out;
+}
+#endif
+
 template<typename CharT, class Traits, typename D, typename U, typename Rep>
 void to_stream(std::basic_ostream<CharT, Traits>& os, const quantity<D, U, Rep>& q)
 {
-  os << q.number();
+  number_to_stream(os, q.number());
   constexpr auto symbol = detail::unit_text<D, U>();
   if constexpr (!symbol.standard().empty()) {
     os << " " << symbol.standard();
@@ -49,7 +90,7 @@ void to_stream(std::basic_ostream<CharT, Traits>& os, const quantity<D, U, Rep>&
 
 template<typename CharT, typename Traits, typename D, typename U, typename Rep>
 std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const quantity<D, U, Rep>& q)
-  requires requires { os << q.number(); }
+  requires requires { detail::number_to_stream(os, q.number()); }
 {
   if (os.width()) {
     // std::setw() applies to the whole quantity output so it has to be first put into std::string
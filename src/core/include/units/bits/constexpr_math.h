@@ -22,223 +22,611 @@
 
 #pragma once
 
-#include <gsl/gsl-lite.hpp>
 #include <units/bits/external/hacks.h>
+#include <units/bits/int128.h>
 #include <units/bits/math_concepts.h>
 #include <units/bits/ratio_maths.h>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
 
 namespace units::detail {
 
-struct decimal_fp {
-  double significant;
-  std::intmax_t exponent;
-};
+// powers 2^32, 2^16, ..., 2^1 used to scale by powers of 2 in a few steps (multiplications by them are exact)
+template<std::floating_point T>
+inline constexpr std::array<T, 6> binary_scales = {0x1p32, 0x1p16, 0x1p8, 0x1p4, 0x1p2, 0x1p1};
+
+/* splits a finite and positive v into m * 2^exponent where 0.5 <= m < 1 (like std::frexp)
+ scaling by powers of 2 is exact so the significant bits of v are not affected
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_frexp(T v, int& exponent) noexcept
+{
+  constexpr T big = 0x1p64;
+  exponent = 0;
+  for (; v >= big; exponent += 64) v /= big;
+  for (; v < 1 / big; exponent -= 64) v *= big;
+  // binary search of the remaining exponent in [-64, 64)
+  int shift = 32;
+  for (const T scale : binary_scales<T>) {
+    if (v >= scale) {
+      v /= scale;
+      exponent += shift;
+    } else if (v < 1 / scale) {
+      v *= scale;
+      exponent -= shift;
+    }
+    shift /= 2;
+  }
+  // v is in [0.5, 2) here
+  if (v >= 1) {
+    v /= 2;
+    ++exponent;
+  }
+  return v;
+}
+
+/* computes v * 2^exponent (like std::ldexp) */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_ldexp(T v, int exponent) noexcept
+{
+  constexpr T big = 0x1p64;
+  for (; exponent >= 64; exponent -= 64) v *= big;
+  for (; exponent <= -64; exponent += 64) v /= big;
+  int shift = 32;
+  for (const T scale : binary_scales<T>) {
+    if (exponent >= shift) {
+      v *= scale;
+      exponent -= shift;
+    } else if (exponent <= -shift) {
+      v /= scale;
+      exponent += shift;
+    }
+    shift /= 2;
+  }
+  return v;
+}
 
-[[nodiscard]] constexpr decimal_fp to_decimal(double v) noexcept
+template<std::floating_point T>
+[[nodiscard]] constexpr bool is_nan(T v) noexcept
 {
   UNITS_DIAGNOSTIC_PUSH
   UNITS_DIAGNOSTIC_IGNORE_FLOAT_EQUAL
-  if (v == 0) {
-    return {.significant = 0.0, .exponent = 0};
-  }
+  return v != v;
+  UNITS_DIAGNOSTIC_POP
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr bool is_finite(T v) noexcept
+{
+  UNITS_DIAGNOSTIC_PUSH
+  UNITS_DIAGNOSTIC_IGNORE_FLOAT_EQUAL
+  return v == v && v != std::numeric_limits<T>::infinity() && v != -std::numeric_limits<T>::infinity();
   UNITS_DIAGNOSTIC_POP
+}
 
-  double significant = abs(v);
-  std::intmax_t exponent = 0;
+/* computes the rounding error of a * b (so that a * b == product + error exactly) with Dekker's algorithm */
+template<std::floating_point T>
+[[nodiscard]] constexpr T product_error(T a, T b, T product) noexcept
+{
+  constexpr T split = static_cast<T>((1ULL << ((std::numeric_limits<T>::digits + 1) / 2)) + 1);
+  const T ta = split * a;
+  const T a_hi = ta - (ta - a);
+  const T a_lo = a - a_hi;
+  const T tb = split * b;
+  const T b_hi = tb - (tb - b);
+  const T b_lo = b - b_hi;
+  return ((a_hi * b_hi - product) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+}
 
-  while (significant < 1) {
-    significant *= 10.0;
-    --exponent;
+/* the below exp and log are evaluated in `long double` so the `double` results are within 1 ULP of the exact ones
+ (on the platforms where `long double` is wider than `double`)
+ both reduce their arguments with small compile-time tables so that only a few terms of their series are evaluated
+ ln(2) is split into a part with 32 significant bits (so its products with the exponents are exact) and the rest
+ */
+inline constexpr long double ln2_hi = 0.69314718036912381649017333984375L;
+inline constexpr long double ln2_lo = 1.9082149292705878161442656807550013e-10L;
+
+// the number of terms of a series with the given term bounds needed for the precision of T
+// (12 guard bits leave the truncation error far below the rounding of the `long double` result to T)
+template<std::floating_point T, typename F>
+[[nodiscard]] consteval int series_terms(F term_bound) noexcept
+{
+  const long double epsilon = constexpr_ldexp(1.0L, -std::numeric_limits<T>::digits - 12);
+  int n = 1;
+  while (term_bound(n) >= epsilon) ++n;
+  return n;
+}
+
+// 1/n! for the Taylor series of e^r with |r| <= RMaxPerMille / 1000
+template<std::floating_point T, int RMaxPerMille>
+inline constexpr auto exp_coefficients = []() {
+  constexpr int terms = series_terms<T>([](int n) {
+    long double term = 1;
+    for (int i = 1; i <= n; ++i) term *= RMaxPerMille * 1e-3L / i;
+    return term;
+  });
+  std::array<long double, static_cast<std::size_t>(terms) + 1> coeffs{};
+  coeffs[0] = 1;
+  for (int i = 1; i <= terms; ++i) coeffs[static_cast<std::size_t>(i)] = coeffs[static_cast<std::size_t>(i - 1)] / i;
+  return coeffs;
+}();
+
+// e^r - 1 with |r| <= RMaxPerMille / 1000
+template<std::floating_point T, int RMaxPerMille>
+[[nodiscard]] constexpr long double expm1_series(long double r) noexcept
+{
+  constexpr auto& coeffs = exp_coefficients<T, RMaxPerMille>;
+  long double sum = 0;
+  for (auto i = coeffs.size() - 1; i > 0; --i) sum = r * (coeffs[i] + sum);
+  return sum;
+}
+
+// 2^(j/32) for j in [0, 32)
+inline constexpr auto exp2_table = []() {
+  std::array<long double, 32> table{};
+  constexpr long double ln2 = 0.693147180559945309417232121458176568L;
+  for (std::size_t j = 0; j < table.size(); ++j)
+    table[j] = 1 + expm1_series<long double, 700>(static_cast<long double>(j) / 32 * ln2);
+  return table;
+}();
+
+// 1/(2n+1) for the series of atanh(s) / s with |s| <= SMaxPerMille / 1000
+template<std::floating_point T, int SMaxPerMille>
+inline constexpr auto atanh_coefficients = []() {
+  constexpr int terms = series_terms<T>([](int n) {
+    long double term = 1;
+    for (int i = 0; i < n; ++i) term *= SMaxPerMille * SMaxPerMille * 1e-6L;
+    return term / (2 * n + 1);
+  });
+  std::array<long double, static_cast<std::size_t>(terms) + 1> coeffs{};
+  for (int i = 0; i <= terms; ++i) coeffs[static_cast<std::size_t>(i)] = 1.0L / (2 * i + 1);
+  return coeffs;
+}();
+
+// ln(m / c) = 2 * atanh(s) where s = (m - c) / (m + c) and |s| <= SMaxPerMille / 1000
+template<std::floating_point T, int SMaxPerMille>
+[[nodiscard]] constexpr long double log_series(long double m, long double c) noexcept
+{
+  const long double s = (m - c) / (m + c);
+  const long double s2 = s * s;
+  constexpr auto& coeffs = atanh_coefficients<T, SMaxPerMille>;
+  long double sum = 0;
+  for (auto i = coeffs.size() - 1; i > 0; --i) sum = s2 * (coeffs[i] + sum);
+  return 2 * s + 2 * s * sum;
+}
+
+// ln(j/32) for j in [22, 46] (the multiples of 1/32 around [sqrt(1/2), sqrt(2)))
+inline constexpr std::size_t log_table_first = 22;
+inline constexpr auto log_table = []() {
+  std::array<long double, 25> table{};
+  for (std::size_t j = 0; j < table.size(); ++j)
+    table[j] = log_series<long double, 190>(static_cast<long double>(log_table_first + j) / 32, 1);
+  return table;
+}();
+
+/* computes e^v with the reduction e^v = 2^(k/32) * e^r where v = k * ln(2)/32 + r and |r| <= ln(2)/64
+ 2^(k/32) is an exact power of 2 times a value from the `exp2_table` and e^r converges in a few terms
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_exp(T v) noexcept
+{
+  using wide = long double;
+  if (!(v == v)) return v;  // NaN
+  // beyond these limits the results overflow or underflow any of the floating-point types
+  if (v > T(11357)) return std::numeric_limits<T>::infinity();
+  if (v < T(-11400)) return T(0);
+
+  const auto x = static_cast<wide>(v);
+  constexpr wide inv_ln2 = 1.44269504088896340735992468100189214L;
+  const auto k = static_cast<int>(x * 32 * inv_ln2 + (x < 0 ? wide(-0.5) : wide(0.5)));
+  const wide r = (x - k * (ln2_hi / 32)) - k * (ln2_lo / 32);
+  const int j = k & 31;  // k - j is a multiple of 32 also for negative k
+  const wide scale = exp2_table[static_cast<std::size_t>(j)];
+  return static_cast<T>(constexpr_ldexp(scale + scale * expm1_series<T, 11>(r), (k - j) / 32));
+}
+
+/* computes ln(v) with the reduction ln(v) = k * ln(2) + ln(c) + ln(m / c) where v = m * 2^k, sqrt(1/2) <= m < sqrt(2),
+ and c is the nearest multiple of 1/32 with ln(c) in the `log_table`
+ ln(m / c) = 2 * atanh(s) where s = (m - c) / (m + c) and |s| < 0.011 so the series of atanh converges in a few terms
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_log(T v) noexcept
+{
+  using wide = long double;
+  if (v < 0 || !(v == v)) return std::numeric_limits<T>::quiet_NaN();
+  if (!(v > 0)) return -std::numeric_limits<T>::infinity();
+  if (!is_finite(v)) return v;
+
+  int k = 0;
+  auto m = static_cast<wide>(constexpr_frexp(v, k));
+  constexpr wide inv_sqrt2 = 0.707106781186547524400844362104849039L;
+  if (m < inv_sqrt2) {
+    m *= 2;
+    --k;
   }
+  const auto j = static_cast<std::size_t>(m * 32 + wide(0.5));
+  const wide log_m = log_table[j - log_table_first] + log_series<T, 11>(m, static_cast<wide>(j) / 32);
+  return static_cast<T>(k * ln2_hi + (k * ln2_lo + log_m));
+}
+
+/* computes v^exponent as e^(exponent * ln(v)) for v >= 0
+ the 64-bit significand of the x87 `long double` keeps the product within 1 ULP (of double) for the results that do
+ not overflow; where `long double` is not wider than `double` (e.g. MSVC, or ARM) the error of the product grows with
+ its magnitude up to about |exponent * ln(v)| ULPs
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_pow(T v, T exponent) noexcept
+{
+  using wide = long double;
+  if (is_nan(v) || is_nan(exponent)) return std::numeric_limits<T>::quiet_NaN();
+  if (v < 0) return std::numeric_limits<T>::quiet_NaN();
+  if (!(v > 0)) return exponent > 0 ? T(0) : (exponent < 0 ? std::numeric_limits<T>::infinity() : T(1));
+  return static_cast<T>(constexpr_exp(static_cast<wide>(exponent) * constexpr_log(static_cast<wide>(v))));
+}
+
+/* computes the square root with Newton iterations on the significant reduced to [0.25, 1)
+ the last iteration uses the exact residual so the result is within 1 ULP (most often equal) of std::sqrt
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_sqrt(T v) noexcept
+{
+  if (v < 0) return std::numeric_limits<T>::quiet_NaN();
+  if (!is_finite(v) || !(v > 0)) return v;  // NaN, infinity, and zero
 
-  while (significant >= 10) {
-    significant /= 10.0;
+  int exponent = 0;
+  T m = constexpr_frexp(v, exponent);
+  if (exponent % 2 != 0) {
+    m /= 2;
     ++exponent;
   }
 
-  if (v < 0) {
-    significant = -significant;
-  }
+  // linear initial approximation (max relative error of 4%) doubles the number of correct bits with every iteration
+  T r = T(0.41731) + T(0.59016) * m;
+  for (int i = 0; i < 6; ++i) r = (r + m / r) / 2;
+  const T square = r * r;
+  r += ((m - square) - product_error(r, r, square)) / (2 * r);
+  return constexpr_ldexp(r, exponent / 2);
+}
 
-  return {.significant = significant, .exponent = exponent};
+/* computes the cubic root with Newton iterations on the significant reduced to [0.125, 1)
+ the last iteration uses the (almost) exact residual so the result is within 1 ULP of std::cbrt
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_cbrt(T v) noexcept
+{
+  if (!is_finite(v) || !(v < 0 || v > 0)) return v;  // NaN, infinities, and zeros
+  if (v < 0) return -constexpr_cbrt(-v);
+
+  int exponent = 0;
+  T m = constexpr_frexp(v, exponent);
+  for (; exponent % 3 != 0; ++exponent) m /= 2;
+
+  T r = T(0.4) + T(0.6) * m;
+  for (int i = 0; i < 8; ++i) r -= (r - m / (r * r)) / 3;
+  const T square = r * r;
+  const T square_error = product_error(r, r, square);
+  const T cube = square * r;
+  const T cube_error = product_error(square, r, cube) + square_error * r;
+  r += ((m - cube) - cube_error) / (3 * square);
+  return constexpr_ldexp(r, exponent / 3);
 }
 
-/* approximate natural log as https://math.stackexchange.com/a/977836
- far slower than std::log but works at compile time with similar accuracy
+/* Taylor series of sin and cos evaluated with the Horner's scheme (starting from the smallest terms)
+ 16 terms are enough for all of the floating-point types but only accurate for the arguments reduced to [-pi/4, pi/4]
  */
-[[nodiscard]] constexpr double constexpr_log(double v) noexcept
-{
-  gsl_Expects(v > 0);
-
-  // lookup table to speed up convergence for all significant values
-  // significant values of 7 and greater benefit mostly as they now converge in 5 terms compared to O(10)-O(100)
-  // required without the table
-  //
-  // using python:
-  // >>> import math
-  // >>> for i in range(1, 100):
-  // ...     print(f"/* log({i:>2d}) = */ {math.log(i):.16f},")
-  constexpr std::array<double, 99> log_table{
-    /* log( 1) = */ 0.0000000000000000,
-    /* log( 2) = */ 0.6931471805599453,
-    /* log( 3) = */ 1.0986122886681098,
-    /* log( 4) = */ 1.3862943611198906,
-    /* log( 5) = */ 1.6094379124341003,
-    /* log( 6) = */ 1.7917594692280550,
-    /* log( 7) = */ 1.9459101490553132,
-    /* log( 8) = */ 2.0794415416798357,
-    /* log( 9) = */ 2.1972245773362196,
-    /* log(10) = */ 2.3025850929940459,
-    /* log(11) = */ 2.3978952727983707,
-    /* log(12) = */ 2.4849066497880004,
-    /* log(13) = */ 2.5649493574615367,
-    /* log(14) = */ 2.6390573296152584,
-    /* log(15) = */ 2.7080502011022101,
-    /* log(16) = */ 2.7725887222397811,
-    /* log(17) = */ 2.8332133440562162,
-    /* log(18) = */ 2.8903717578961645,
-    /* log(19) = */ 2.9444389791664403,
-    /* log(20) = */ 2.9957322735539909,
-    /* log(21) = */ 3.0445224377234230,
-    /* log(22) = */ 3.0910424533583161,
-    /* log(23) = */ 3.1354942159291497,
-    /* log(24) = */ 3.1780538303479458,
-    /* log(25) = */ 3.2188758248682006,
-    /* log(26) = */ 3.2580965380214821,
-    /* log(27) = */ 3.2958368660043291,
-    /* log(28) = */ 3.3322045101752038,
-    /* log(29) = */ 3.3672958299864741,
-    /* log(30) = */ 3.4011973816621555,
-    /* log(31) = */ 3.4339872044851463,
-    /* log(32) = */ 3.4657359027997265,
-    /* log(33) = */ 3.4965075614664802,
-    /* log(34) = */ 3.5263605246161616,
-    /* log(35) = */ 3.5553480614894135,
-    /* log(36) = */ 3.5835189384561099,
-    /* log(37) = */ 3.6109179126442243,
-    /* log(38) = */ 3.6375861597263857,
-    /* log(39) = */ 3.6635616461296463,
-    /* log(40) = */ 3.6888794541139363,
-    /* log(41) = */ 3.7135720667043080,
-    /* log(42) = */ 3.7376696182833684,
-    /* log(43) = */ 3.7612001156935624,
-    /* log(44) = */ 3.7841896339182610,
-    /* log(45) = */ 3.8066624897703196,
-    /* log(46) = */ 3.8286413964890951,
-    /* log(47) = */ 3.8501476017100584,
-    /* log(48) = */ 3.8712010109078911,
-    /* log(49) = */ 3.8918202981106265,
-    /* log(50) = */ 3.9120230054281460,
-    /* log(51) = */ 3.9318256327243257,
-    /* log(52) = */ 3.9512437185814275,
-    /* log(53) = */ 3.9702919135521220,
-    /* log(54) = */ 3.9889840465642745,
-    /* log(55) = */ 4.0073331852324712,
-    /* log(56) = */ 4.0253516907351496,
-    /* log(57) = */ 4.0430512678345503,
-    /* log(58) = */ 4.0604430105464191,
-    /* log(59) = */ 4.0775374439057197,
-    /* log(60) = */ 4.0943445622221004,
-    /* log(61) = */ 4.1108738641733114,
-    /* log(62) = */ 4.1271343850450917,
-    /* log(63) = */ 4.1431347263915326,
-    /* log(64) = */ 4.1588830833596715,
-    /* log(65) = */ 4.1743872698956368,
-    /* log(66) = */ 4.1896547420264252,
-    /* log(67) = */ 4.2046926193909657,
-    /* log(68) = */ 4.2195077051761070,
-    /* log(69) = */ 4.2341065045972597,
-    /* log(70) = */ 4.2484952420493594,
-    /* log(71) = */ 4.2626798770413155,
-    /* log(72) = */ 4.2766661190160553,
-    /* log(73) = */ 4.2904594411483910,
-    /* log(74) = */ 4.3040650932041702,
-    /* log(75) = */ 4.3174881135363101,
-    /* log(76) = */ 4.3307333402863311,
-    /* log(77) = */ 4.3438054218536841,
-    /* log(78) = */ 4.3567088266895917,
-    /* log(79) = */ 4.3694478524670215,
-    /* log(80) = */ 4.3820266346738812,
-    /* log(81) = */ 4.3944491546724391,
-    /* log(82) = */ 4.4067192472642533,
-    /* log(83) = */ 4.4188406077965983,
-    /* log(84) = */ 4.4308167988433134,
-    /* log(85) = */ 4.4426512564903167,
-    /* log(86) = */ 4.4543472962535073,
-    /* log(87) = */ 4.4659081186545837,
-    /* log(88) = */ 4.4773368144782069,
-    /* log(89) = */ 4.4886363697321396,
-    /* log(90) = */ 4.4998096703302650,
-    /* log(91) = */ 4.5108595065168497,
-    /* log(92) = */ 4.5217885770490405,
-    /* log(93) = */ 4.5325994931532563,
-    /* log(94) = */ 4.5432947822700038,
-    /* log(95) = */ 4.5538768916005408,
-    /* log(96) = */ 4.5643481914678361,
-    /* log(97) = */ 4.5747109785033828,
-    /* log(98) = */ 4.5849674786705723,
-    /* log(99) = */ 4.5951198501345898,
+inline constexpr int taylor_terms = 16;
+
+template<std::floating_point T>
+[[nodiscard]] constexpr T sin_taylor(T r) noexcept
+{
+  const T r2 = r * r;
+  T sum = 1;
+  for (int n = taylor_terms; n > 0; --n) sum = 1 - r2 / static_cast<T>((2 * n) * (2 * n + 1)) * sum;
+  return r * sum;
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr T cos_taylor(T r) noexcept
+{
+  const T r2 = r * r;
+  T sum = 1;
+  for (int n = taylor_terms; n > 0; --n) sum = 1 - r2 / static_cast<T>((2 * n - 1) * (2 * n)) * sum;
+  return sum;
+}
+
+// the bits of 2/pi after the binary point (there are no bits before it); enough for all the exponents below 2^16384
+inline constexpr std::array<std::uint64_t, 261> two_over_pi_bits = {
+  0xa2f9836e4e441529, 0xfc2757d1f534ddc0, 0xdb6295993c439041, 0xfe5163abdebbc561, 0xb7246e3a424dd2e0,
+  0x06492eea09d1921c, 0xfe1deb1cb129a73e, 0xe88235f52ebb4484, 0xe99c7026b45f7e41, 0x3991d639835339f4,
+  0x9c845f8bbdf9283b, 0x1ff897ffde05980f, 0xef2f118b5a0a6d1f, 0x6d367ecf27cb09b7, 0x4f463f669e5fea2d,
+  0x7527bac7ebe5f17b, 0x3d0739f78a5292ea, 0x6bfb5fb11f8d5d08, 0x56033046fc7b6bab, 0xf0cfbc209af4361d,
+  0xa9e391615ee61b08, 0x6599855f14a06840, 0x8dffd8804d732731, 0x06061556ca73a8c9, 0x60e27bc08c6b47c4,
+  0x19c367cddce8092a, 0x8359c4768b961ca6, 0xddaf44d15719053e, 0xa5ff07053f7e33e8, 0x32c2de4f98327dbb,
+  0xc33d26ef6b1e5ef8, 0x9f3a1f35caf27f1d, 0x87f121907c7c246a, 0xfa6ed5772d30433b, 0x15c614b59d19c3c2,
+  0xc4ad414d2c5d000c, 0x467d862d71e39ac6, 0x9b0062337cd2b497, 0xa7b4d55537f63ed7, 0x1810a3fc764d2a9d,
+  0x64abd770f87c6357, 0xb07ae715175649c0, 0xd9d63b3884a7cb23, 0x24778ad623545ab9, 0x1f001b0af1dfce19,
+  0xff319f6a1e666157, 0x9947fbacd87f7eb7, 0x652289e83260bfe6, 0xcdc4ef09366cd43f, 0x5dd7de16de3b5892,
+  0x9bde2822d2e88628, 0x4d58e232cac616e3, 0x08cb7de050c017a7, 0x1df35be01834132e, 0x6212830148835b8e,
+  0xf57fb0adf2e91e43, 0x4a48d36710d8ddaa, 0x425faece616aa428, 0x0ab499d3f2a6067f, 0x775c83c2a3883c61,
+  0x78738a5a8cafbdd7, 0x6f63a62dcbbff4ef, 0x818d67c12645ca55, 0x36d9cad2a8288d61, 0xc277c9121426049b,
+  0x4612c459c444c5c8, 0x91b24df31700ad43, 0xd4e5492910d5fdfc, 0xbe00cc941eeece70, 0xf53e1380f1ecc3e7,
+  0xb328f8c79405933e, 0x71c1b3092ef3450b, 0x9c12887b20ab9fb5, 0x2ec292472f327b6d, 0x550c90a7721fe76b,
+  0x96cb314a1679e279, 0x4189dff49794e884, 0xe6e29731996bed88, 0x365f5f0efdbbb49a, 0x486ca46742727132,
+  0x5d8db8159f09e5bc, 0x25318d3974f71c05, 0x30010c0d68084b58, 0xee2c90aa4702e774, 0x24d6bda67df77248,
+  0x6eef169fa6948ef6, 0x91b45153d1f20acf, 0x3398207e4bf56863, 0xb25f3edd035d407f, 0x8985295255c06437,
+  0x10d86d324832754c, 0x5bd4714e6e5445c1, 0x090b69f52ad56614, 0x9d072750045ddb3b, 0xb4c576ea17f9877d,
+  0x6b49ba271d296996, 0xacccc65414ad6ae2, 0x9089d98850722cbe, 0xa4049407777030f3, 0x27fc00a871ea49c2,
+  0x663de06483dd9797, 0x3fa3fd94438c860d, 0xde41319d39928c70, 0xdde7b7173bdf082b, 0x3715a0805c93805a,
+  0x921110d8e80faf80, 0x6c4bffdb0f903876, 0x185915a562bbcb61, 0xb989c7bd401004f2, 0xd2277549f6b6ebbb,
+  0x22dbaa140a2f2689, 0x768364333b091a94, 0x0eaa3a51c2a31dae, 0xedaf12265c4dc26d, 0x9c7a2d9756c0833f,
+  0x03f6f0098c402b99, 0x316d07b43915200c, 0x5bc3d8c492f54bad, 0xc6a5ca4ecd37a736, 0xa9e69492ab6842dd,
+  0xde6319ef8c76528b, 0x6837dbfcaba1ae31, 0x15dfa1ae00dafb0c, 0x664d64b705ed3065, 0x29bf56573aff47b9,
+  0xf96af3be75df9328, 0x3080abf68c6615cb, 0x040622fa1de4d9a4, 0xb33d8f1b5709cd36, 0xe9424ea4be13b523,
+  0x331aaaf0a8654fa5, 0xc1d20f3f0bcd785b, 0x76f923048b7b7217, 0x8953a6c6e26e6f00, 0xebef584a9bb7dac4,
+  0xba66aacfcf761d02, 0xd12df1b1c1998c77, 0xadc3da4886a05df7, 0xf480c62ff0ac9aec, 0xddbc5c3f6dded01f,
+  0xc790b6db2a3a25a3, 0x9aaf009353ad0457, 0xb6b42d297e804ba7, 0x07da0eaa76a1597b, 0x2a12162db7dcfde5,
+  0xfafedb89fdbe896c, 0x76e4fca90670803e, 0x156e85ff87fd073e, 0x2833676186182aea, 0xbd4dafe7b36e6d8f,
+  0x3967955bbf3148d7, 0x8416df30432dc735, 0x6125ce70c9b8cb30, 0xfd6cbfa200a4e46c, 0x05a0dd5a476f21d2,
+  0x1262845cb9496170, 0xe0566b0152993755, 0x50b7d51ec4f1335f, 0x6e13e4305da92e85, 0xc3b21d3632a1a4b7,
+  0x08d4b1ea21f716e4, 0x698f77ff2780030c, 0x2d408da0cd4f99a5, 0x20d3a2b30a5d2f42, 0xf9b4cbda11d0be7d,
+  0xc1db9bbd17ab81a2, 0xca5c6a0817552e55, 0x0027f0147f8607e1, 0x640b148d4196debe, 0x872afddab6256b34,
+  0x897bfef3059ebfb9, 0x4f6a68a82a4a5ac4, 0x4fbcf82d985ad795, 0xc7f48d4d0da63a20, 0x5f57a4b13f149538,
+  0x800120cc86dd71b6, 0xdec9f560bf11654d, 0x6b0701acb08cd0c0, 0xb24855510efb1ec3, 0x72953b06a33540c0,
+  0x7bdc06cc45e0fa29, 0x4ec8cad641f3e8de, 0x647cd8649b31bed9, 0xc397a4d45877c5e3, 0x6913daf03c3aba46,
+  0x18465f7555f5bdd2, 0xc6926e5d2eaced44, 0x0e423e1c87c461e9, 0xfd29f3d6e7ca7c22, 0x35916fc5e0088dd7,
+  0xffe26a6ec6fdb0c1, 0x0893745d7cb2ad6b, 0x9d6ecd7b723e6a11, 0xc6a9cff7df7329ba, 0xc9b55100b70db2e2,
+  0x24ba74607de58ad8, 0x742c150d0c188194, 0x667e162901767a9f, 0xbefdfdef4556367e, 0xd913d9ecb9ba8bfc,
+  0x97c427a831c36ef1, 0x36c59456a8d8b5a8, 0xb40ecccf2d891234, 0x576f89562ce3ce99, 0xb920d6aa5e6b9c2a,
+  0x3ecc5f114a0bfdfb, 0xf4e16d3b8e2c86e2, 0x84d4e9a9b4fcd1ee, 0xefc9352e61392f44, 0x2138c8d91b0afc81,
+  0x6a4afbd81c2f84b4, 0x538c994ecc2254dc, 0x552ad6c6c096190b, 0xb8701a649569605a, 0x26ee523f0f117f11,
+  0xb5f4f5cbfc2dbc34, 0xeebc34cc5de8605e, 0xdd9b8e67ef3392b8, 0x17c99b5861bc57e1, 0xc68351103ed84871,
+  0xdddd1c2da118af46, 0x2c21d7f359987ad9, 0xc0549efa864ffc06, 0x56ae79e536228922, 0xad38dc9367aae855,
+  0x3826829be7caa40d, 0x51b133990ed7a948, 0x0569f0b265a7887f, 0x974c8836d1f9b392, 0x214a827b21cf98dc,
+  0x9f405547dc3a74e1, 0x42eb67df9dfe5fd4, 0x5ea4677b7aacbaa2, 0xf65523882b55ba41, 0x086e59862a218347,
+  0x39e6e389d49ee540, 0xfb49e956ffca0f1c, 0x8a59c52bfa94c5c1, 0xd3cfc50fae5adb86, 0xc5476243853b8621,
+  0x94792c8761107b4c, 0x2a1a2c8012bf4390, 0x2688893c78e4c4a8, 0x7bdbe5c23ac4eaf4, 0x268a67f7bf920d2b,
+  0xa365b1933d0b7cbd, 0xdc51a463dd27dde1, 0x6919949a9529a828, 0xce68b4ed09209f44, 0xca984e638270237c,
+  0x7e32b90f8ef5a7e7, 0x561408f1212a9db5, 0x4d7e6f5119a5abf9, 0xb5d6df8261dd9602, 0x36169f3ac4a1a283,
+  0x6ded727a8d39a9b8, 0x825c326b5b2746ed, 0x34007700d255f4fc, 0x4d59018071e0e13f, 0x89b295f364a8f1ae,
+  0xa74b38fc4ceab2bb
+};
+
+// pi/2 * 2^127 (the fixed-point pi/2 with 127 fraction bits)
+inline constexpr uint64_pair half_pi_bits = {0xc90fdaa22168c234, 0xc4c6628b80dc1cd1};
+
+// 64 bits of 2/pi starting from the one of weight 2^-first
+[[nodiscard]] constexpr std::uint64_t two_over_pi_word(int first) noexcept
+{
+  const auto word = [](int index) -> std::uint64_t {
+    return index >= 0 && index < static_cast<int>(two_over_pi_bits.size())
+             ? two_over_pi_bits[static_cast<std::size_t>(index)]
+             : 0;
+  };
+  const int bit = first - 1;
+  if (bit < 0) return bit > -64 ? word(0) >> -bit : 0;
+  const int shift = bit % 64;
+  if (shift == 0) return word(bit / 64);
+  return (word(bit / 64) << shift) | (word(bit / 64 + 1) >> (64 - shift));
+}
+
+/* Payne-Hanek reduction of a finite and positive v to r in [-pi/4, pi/4] such that v = r + quadrant * pi/2
+ the significand of v is split into two 64-bit integers and each of them is multiplied by only those 320 bits of 2/pi
+ that affect the last two bits of the quadrant and the fraction in the fixed-point arithmetic, so the reduction is
+ accurate for all the finite arguments
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr std::intmax_t reduce_half_pi_large(T v, T& r) noexcept
+{
+  static_assert(std::numeric_limits<T>::digits <= 128 && std::numeric_limits<T>::max_exponent <= 16384);
+  using word = std::uint64_t;
+
+  int exponent = 0;
+  const T m = constexpr_frexp(v, exponent) * 0x1p64;
+  const auto hi = static_cast<word>(m);
+  const auto lo = static_cast<word>((m - static_cast<T>(hi)) * 0x1p64);
+
+  // v * 2/pi mod 4 in the fixed-point with 318 fraction bits (the most significant word first)
+  std::array<word, 5> x{};
+  const auto accumulate = [&](word c, int e) {
+    // c * 2^e * 2/pi where the bits of 2/pi of weights above 2^(1-e) only add multiples of 4
+    word carry = 0;
+    for (std::size_t k = x.size(); k-- > 0;) {
+      const auto [p_hi, p_lo] = umul128(c, two_over_pi_word(e - 1 + 64 * static_cast<int>(k)));
+      const word sum = x[k] + p_lo;
+      x[k] = sum + carry;
+      carry = p_hi + static_cast<word>(sum < p_lo) + static_cast<word>(x[k] < carry);
+    }
+  };
+  accumulate(hi, exponent - 64);
+  if (lo != 0) accumulate(lo, exponent - 128);
+
+  auto quadrant = static_cast<std::intmax_t>(x[0] >> 62);
+  const bool round_up = (x[0] >> 61) & 1;
+  if (round_up) {
+    // the fraction is negated to get the distance to the next multiple of pi/2
+    ++quadrant;
+    bool carry = true;
+    for (std::size_t k = x.size(); k-- > 0;) {
+      x[k] = ~x[k] + static_cast<word>(carry);
+      carry = carry && x[k] == 0;
+    }
+  }
+  x[0] &= (word{1} << 62) - 1;
+
+  // the 128 most significant bits of the fraction multiplied by pi/2
+  std::size_t first = 0;
+  while (first < x.size() && x[first] == 0) ++first;
+  if (first == x.size()) {
+    r = 0;
+    return quadrant;
+  }
+  const auto at = [&](std::size_t k) { return k < x.size() ? x[k] : word{0}; };
+  const int zeros = std::countl_zero(x[first]);
+  const auto shifted = [&](std::size_t k) {
+    return zeros == 0 ? at(k) : (at(k) << zeros) | (at(k + 1) >> (64 - zeros));
   };
-  decimal_fp x = to_decimal(v);
-
-  // dividing the significant by nearest lower value in [1.0, 1.1, 1.2, ..., 9.9] will greatly improve convergence
-  x.significant *= 10;
-  const auto isignificant = static_cast<std::size_t>(x.significant);
-  x.significant /= static_cast<double>(isignificant);
-  const double result = static_cast<double>(x.exponent - 1) * log_table[9] + log_table[isignificant - 1];
-
-  // 1.0 <= significant < 1.1 converges rapidly
-  const double y = (x.significant - 1) / (x.significant + 1);
-  const double y_squared = y * y;
-  double sum = 0;
-  // 5 terms are needed for convergence to machine precision in the worst case scenario
-  for (int k = 4; k > 0; --k) {
-    sum = y_squared * (1 / (2 * static_cast<double>(k) + 1) + sum);
+  const uint64_pair a = {shifted(first), shifted(first + 1)};
+  // the weight of the most significant bit of the fraction is 2^(msb - 318)
+  int msb = static_cast<int>(x.size() - 1 - first) * 64 + 63 - zeros;
+
+  const uint64_pair hh = umul128(a.hi, half_pi_bits.hi);
+  const uint64_pair hl = umul128(a.hi, half_pi_bits.lo);
+  const uint64_pair lh = umul128(a.lo, half_pi_bits.hi);
+  const uint64_pair ll = umul128(a.lo, half_pi_bits.lo);
+  const word mid = hl.lo + lh.lo;
+  const word mid_carry = static_cast<word>(mid < hl.lo) + static_cast<word>(mid + ll.hi < mid);
+  word p_lo = hh.lo + hl.hi;
+  word p_hi = hh.hi + static_cast<word>(p_lo < hh.lo);
+  p_lo += lh.hi;
+  p_hi += static_cast<word>(p_lo < lh.hi);
+  p_lo += mid_carry;
+  p_hi += static_cast<word>(p_lo < mid_carry);
+  // both factors are normalized so at most one bit of the product is lost here
+  if ((p_hi >> 63) == 0) {
+    p_hi = (p_hi << 1) | (p_lo >> 63);
+    p_lo <<= 1;
+    --msb;
   }
-  sum = 2 * y * (1 + sum);  // k = 0 term
-  return result + sum;
+
+  // the high word is rounded to the precision of T first so that the low word is not lost in the double rounding
+  constexpr int dropped = std::numeric_limits<T>::digits < 64 ? 64 - std::numeric_limits<T>::digits : 0;
+  const word p_top = p_hi >> dropped << dropped;
+  const T f = static_cast<T>(p_top) + (static_cast<T>(p_hi - p_top) + static_cast<T>(p_lo) * 0x1p-64);
+  // the fraction multiplied by pi/2 is (p_hi:p_lo) * 2^(msb - 444) = f * 2^(msb - 380)
+  r = constexpr_ldexp(f, msb - 380);
+  if (round_up) r = -r;
+  return quadrant;
 }
 
-/* approximate e^x as Taylor series e^x = 1 + x/1! + x^2/2! + x^3/3! +... where N is the order of the Taylor series
- use https://math.stackexchange.com/a/1988927 to improve convergence for large values
+/* reduces v to r in [-pi/4, pi/4] such that v = r + quadrant * pi/2
+ Cody-Waite reduction is used for the arguments below 2^20 (fdlibm's `__ieee754_rem_pio2`): pi/2 is split into three
+ parts of 33 significant bits each so that their products with the quadrant are exact for |v| < 2^20 * pi/2; the
+ second and the third part (with their tails) are only used when the first steps cancel more than 16 and 49 bits of v
+ which happens close to the multiples of pi/2; larger arguments are reduced with `reduce_half_pi_large()`
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr std::intmax_t reduce_half_pi(T v, T& r) noexcept
+{
+  constexpr T two_over_pi = static_cast<T>(0.636619772367581343075535053490057448L);
+  constexpr T half_pi_1 = static_cast<T>(1.57079632673412561417e+00L);
+  constexpr T half_pi_1t = static_cast<T>(6.07710050650619224932e-11L);
+  constexpr T half_pi_2 = static_cast<T>(6.07710050630396597660e-11L);
+  constexpr T half_pi_2t = static_cast<T>(2.02226624879595063154e-21L);
+  constexpr T half_pi_3 = static_cast<T>(2.02226624871116645580e-21L);
+  constexpr T half_pi_3t = static_cast<T>(8.47842766036889956997e-32L);
+  constexpr T cody_waite_limit = 0x1p20;
+
+  if (!(v > -cody_waite_limit && v < cody_waite_limit)) {
+    if (v > 0) return reduce_half_pi_large(v, r);
+    const std::intmax_t quadrant = reduce_half_pi_large(-v, r);
+    r = -r;
+    return -quadrant;
+  }
+
+  const auto quadrant = static_cast<std::intmax_t>(v * two_over_pi + (v < 0 ? T(-0.5) : T(0.5)));
+  const auto k = static_cast<T>(quadrant);
+  // the number of the cancelled bits is estimated by comparing the magnitudes of the result and v
+  const T cancelled_16 = abs(v) * T(0x1p-16);
+  const T cancelled_49 = abs(v) * T(0x1p-49);
+  T hi = v - k * half_pi_1;
+  T lo = k * half_pi_1t;
+  r = hi - lo;
+  if (abs(r) < cancelled_16) {
+    T t = hi;
+    lo = k * half_pi_2;
+    hi = t - lo;
+    lo = k * half_pi_2t - ((t - hi) - lo);
+    r = hi - lo;
+    if (abs(r) < cancelled_49) {
+      t = hi;
+      lo = k * half_pi_3;
+      hi = t - lo;
+      lo = k * half_pi_3t - ((t - hi) - lo);
+      r = hi - lo;
+    }
+  }
+  return quadrant;
+}
 
- larger Factor values improve convergence for all values but reduce the precision
-*/
-template<std::size_t N, std::intmax_t Factor = 256>
-  requires gt_zero<Factor>
-[[nodiscard]] constexpr double constexpr_exp(double v) noexcept
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_sin(T v) noexcept
 {
-  if constexpr (N == 0) {
-    return 1.0;
+  if constexpr (sizeof(T) < sizeof(double)) {
+    // the reduction constants are not exact in the narrower types
+    return static_cast<T>(constexpr_sin(static_cast<double>(v)));
   } else {
-    constexpr auto coefficients = []() {
-      std::array<double, N> coeffs;
-      std::size_t factorial = 1;
-      for (std::size_t i = 0; i < N; ++i) {
-        factorial *= i + 1;
-        coeffs[i] = 1.0 / static_cast<double>(factorial);
-      }
-      return coeffs;
-    }();
-
-    const double x = v / static_cast<double>(Factor);
-    double result = 0;
-    for (auto i = static_cast<std::intmax_t>(N - 1); i >= 0; --i) {
-      result = x * (coefficients[static_cast<std::size_t>(i)] + result);
+    if (!is_finite(v)) return std::numeric_limits<T>::quiet_NaN();
+    T r{};
+    switch (reduce_half_pi(v, r) & 3) {
+      case 0: return sin_taylor(r);
+      case 1: return cos_taylor(r);
+      case 2: return -sin_taylor(r);
+      default: return -cos_taylor(r);
     }
+  }
+}
 
-    // for factors of power of 2 this should be replaced by log2(Factor) multiplications by the compiler
-    return pow_impl<Factor>(1 + result);
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_cos(T v) noexcept
+{
+  if constexpr (sizeof(T) < sizeof(double)) {
+    // the reduction constants are not exact in the narrower types
+    return static_cast<T>(constexpr_cos(static_cast<double>(v)));
+  } else {
+    if (!is_finite(v)) return std::numeric_limits<T>::quiet_NaN();
+    T r{};
+    switch (reduce_half_pi(v, r) & 3) {
+      case 0: return cos_taylor(r);
+      case 1: return -sin_taylor(r);
+      case 2: return -cos_taylor(r);
+      default: return sin_taylor(r);
+    }
   }
 }
 
-// default template arguments provide reasonable precision even for fairly large exponents
-// see constexpr_exp for template arguments
-template<std::size_t ExpOrder = 10, std::intmax_t Factor = 128>
-[[nodiscard]] constexpr double constexpr_pow(double v, double exponent) noexcept
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_tan(T v) noexcept
+{
+  if constexpr (sizeof(T) < sizeof(double)) {
+    // the reduction constants are not exact in the narrower types
+    return static_cast<T>(constexpr_tan(static_cast<double>(v)));
+  } else {
+    if (!is_finite(v)) return std::numeric_limits<T>::quiet_NaN();
+    T r{};
+    if (reduce_half_pi(v, r) & 1) return -cos_taylor(r) / sin_taylor(r);
+    return sin_taylor(r) / cos_taylor(r);
+  }
+}
+
+/* computes sqrt(x^2 + y^2) scaled by the larger argument to avoid undue overflow and underflow */
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_hypot(T x, T y) noexcept
+{
+  x = abs(x);
+  y = abs(y);
+  const T scale = x < y ? y : x;
+  if (!is_finite(scale) || !(scale > 0)) return scale;
+  x /= scale;
+  y /= scale;
+  return scale * constexpr_sqrt(x * x + y * y);
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr T constexpr_hypot(T x, T y, T z) noexcept
 {
-  const double x = exponent * constexpr_log(v);
-  return constexpr_exp<ExpOrder, Factor>(x);
+  x = abs(x);
+  y = abs(y);
+  z = abs(z);
+  const T xy = x < y ? y : x;
+  const T scale = xy < z ? z : xy;
+  if (!is_finite(scale) || !(scale > 0)) return scale;
+  x /= scale;
+  y /= scale;
+  z /= scale;
+  return scale * constexpr_sqrt(x * x + y * y + z * z);
 }
 
 }  // namespace units::detail
@@ -50,23 +50,22 @@ constexpr auto operator_text()
 template<typename E, basic_symbol_text Symbol, std::size_t NegativeExpCount, std::size_t Idx>
 constexpr auto exp_text()
 {
-  // get calculation operator + symbol
-  const auto txt = operator_text<(E::num < 0), NegativeExpCount, Idx>() + Symbol;
+  constexpr auto op = operator_text<(E::num < 0), NegativeExpCount, Idx>();
   if constexpr (E::den != 1) {
     // add root part
-    return txt + basic_fixed_string("^(") + regular<abs(E::num)>() + basic_fixed_string("/") + regular<E::den>() +
-           basic_fixed_string(")");
+    return symbol_text_join(op, Symbol, basic_fixed_string("^("), regular<abs(E::num)>(), basic_fixed_string("/"),
+                            regular<E::den>(), basic_fixed_string(")"));
   } else if constexpr (E::num != 1) {
     // add exponent part
     if constexpr (NegativeExpCount > 1) {  // no '/' sign here (only negative exponents)
-      return txt + superscript<E::num>();
+      return symbol_text_join(op, Symbol, superscript<E::num>());
     } else if constexpr (E::num != -1) {  // -1 is replaced with '/' sign here
-      return txt + superscript<abs(E::num)>();
+      return symbol_text_join(op, Symbol, superscript<abs(E::num)>());
     } else {
-      return txt;
+      return symbol_text_join(op, Symbol);
     }
   } else {
-    return txt;
+    return symbol_text_join(op, Symbol);
   }
 }
 
@@ -77,7 +76,7 @@ template<typename... Us, typename... Es, std::size_t... Idxs>
 constexpr auto derived_symbol_text(exponent_list<Es...>, std::index_sequence<Idxs...>)
 {
   constexpr auto neg_exp = negative_exp_count<Es...>;
-  return (exp_text<Es, Us::symbol, neg_exp, Idxs>() + ...);
+  return symbol_text_join(exp_text<Es, Us::symbol, neg_exp, Idxs>()...);
 }
 
 template<DerivedDimension Dim, Unit... Us>
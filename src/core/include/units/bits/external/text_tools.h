@@ -27,6 +27,83 @@
 
 namespace units::detail {
 
+template<typename T>
+struct text_size;
+
+template<typename CharT, std::size_t N>
+struct text_size<basic_fixed_string<CharT, N>> {
+  using standard_char_type = CharT;
+  static constexpr std::size_t standard = N;
+  static constexpr std::size_t ascii = N;
+};
+
+template<typename StandardCharT, std::size_t N, std::size_t M>
+struct text_size<basic_symbol_text<StandardCharT, N, M>> {
+  using standard_char_type = StandardCharT;
+  static constexpr std::size_t standard = N;
+  static constexpr std::size_t ascii = M;
+};
+
+template<typename CharT, std::size_t N>
+[[nodiscard]] constexpr const basic_fixed_string<CharT, N>& standard_text(const basic_fixed_string<CharT, N>& txt)
+{
+  return txt;
+}
+
+template<typename StandardCharT, std::size_t N, std::size_t M>
+[[nodiscard]] constexpr const basic_fixed_string<StandardCharT, N>& standard_text(
+  const basic_symbol_text<StandardCharT, N, M>& txt)
+{
+  return txt.standard();
+}
+
+template<typename CharT, std::size_t N>
+[[nodiscard]] constexpr const basic_fixed_string<CharT, N>& ascii_text(const basic_fixed_string<CharT, N>& txt)
+{
+  return txt;
+}
+
+template<typename StandardCharT, std::size_t N, std::size_t M>
+[[nodiscard]] constexpr const basic_fixed_string<char, M>& ascii_text(const basic_symbol_text<StandardCharT, N, M>& txt)
+{
+  return txt.ascii();
+}
+
+template<typename CharT, std::size_t N>
+constexpr void append_text(CharT* out, std::size_t& pos, const basic_fixed_string<CharT, N>& txt)
+{
+  for (std::size_t i = 0; i != N; ++i) out[pos++] = txt[i];
+}
+
+/**
+ * @brief Concatenates fixed strings and symbol texts in one pass
+ *
+ * Contrary to a chain of `operator+` calls, the size of the result is computed upfront from
+ * the sizes of all the parts, so only one buffer is filled and no intermediate
+ * `basic_symbol_text` specializations are instantiated for partial results.
+ *
+ * @param parts `basic_fixed_string` and `basic_symbol_text` objects to concatenate
+ */
+[[nodiscard]] constexpr auto symbol_text_join() { return basic_symbol_text(""); }
+
+template<typename First, typename... Rest>
+[[nodiscard]] constexpr auto symbol_text_join(const First& first, const Rest&... rest)
+{
+  using standard_char_type = TYPENAME text_size<First>::standard_char_type;
+  constexpr std::size_t standard_size = (text_size<First>::standard + ... + text_size<Rest>::standard);
+  constexpr std::size_t ascii_size = (text_size<First>::ascii + ... + text_size<Rest>::ascii);
+
+  standard_char_type standard[standard_size + 1] = {};
+  char ascii[ascii_size + 1] = {};
+  std::size_t standard_pos = 0;
+  std::size_t ascii_pos = 0;
+  append_text(standard, standard_pos, standard_text(first));
+  append_text(ascii, ascii_pos, ascii_text(first));
+  (append_text(standard, standard_pos, standard_text(rest)), ...);
+  (append_text(ascii, ascii_pos, ascii_text(rest)), ...);
+  return basic_symbol_text<standard_char_type, standard_size, ascii_size>(standard, ascii);
+}
+
 template<std::intmax_t Value>
   requires(0 <= Value) && (Value < 10)
 inline constexpr basic_fixed_string superscript_number = "";
@@ -0,0 +1,54 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/math_concepts.h>
+#include <cstdint>
+
+namespace units::detail {
+
+/**
+ * @brief Raises a value to the compile-time integral power `N`
+ *
+ * The result is computed with a chain of multiplications by squaring (`v^N = (v^(N/2))^2 * v^(N%2)`) unrolled
+ * at compile time. Contrary to `std::pow` the computation is `constexpr` and exact for integral types (as long as
+ * the result does not overflow).
+ *
+ * @tparam N Exponent
+ * @param v Base of the operation
+ */
+template<std::intmax_t N, typename T>
+  requires gt_zero<N>
+[[nodiscard]] constexpr T pow_impl(const T& v) noexcept(noexcept(v * v))
+{
+  if constexpr (N == 1) {
+    return v;
+  } else if constexpr (N % 2 == 0) {
+    const T half = pow_impl<N / 2>(v);
+    return static_cast<T>(half * half);
+  } else {
+    return static_cast<T>(pow_impl<N - 1>(v) * v);
+  }
+}
+
+}  // namespace units::detail
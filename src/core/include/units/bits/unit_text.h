@@ -47,21 +47,23 @@ constexpr auto magnitude_text()
 
 
   if constexpr (num_value == 1 && den_value == 1 && exp10 != 0) {
-    return base_multiplier + superscript<exp10>();
+    return symbol_text_join(base_multiplier, superscript<exp10>());
   } else if constexpr (num_value != 1 || den_value != 1 || exp10 != 0) {
-    auto txt = basic_fixed_string("[") + regular<num_value>();
+    constexpr auto open = basic_fixed_string("[");
+    constexpr auto close = basic_fixed_string("]");
     if constexpr (den_value == 1) {
       if constexpr (exp10 == 0) {
-        return txt + basic_fixed_string("]");
+        return symbol_text_join(open, regular<num_value>(), close);
       } else {
-        return txt + " " + base_multiplier + superscript<exp10>() + basic_fixed_string("]");
+        return symbol_text_join(open, regular<num_value>(), basic_fixed_string(" "), base_multiplier,
+                                superscript<exp10>(), close);
       }
     } else {
       if constexpr (exp10 == 0) {
-        return txt + basic_fixed_string("/") + regular<den_value>() + basic_fixed_string("]");
+        return symbol_text_join(open, regular<num_value>(), basic_fixed_string("/"), regular<den_value>(), close);
       } else {
-        return txt + basic_fixed_string("/") + regular<den_value>() + " " + base_multiplier + superscript<exp10>() +
-               basic_fixed_string("]");
+        return symbol_text_join(open, regular<num_value>(), basic_fixed_string("/"), regular<den_value>(),
+                                basic_fixed_string(" "), base_multiplier, superscript<exp10>(), close);
       }
     }
   } else {
@@ -86,7 +88,7 @@ constexpr auto prefix_or_magnitude_text()
       // print as a ratio of the coherent unit
       constexpr auto txt = magnitude_text<M>();
       if constexpr (SymbolLen > 0 && txt.standard().size() > 0)
-        return txt + basic_fixed_string(" ");
+        return symbol_text_join(txt, basic_fixed_string(" "));
       else
         return txt;
     }
@@ -96,8 +98,8 @@ constexpr auto prefix_or_magnitude_text()
 template<typename... Es, std::size_t... Idxs>
 constexpr auto derived_dimension_unit_text(exponent_list<Es...>, std::index_sequence<Idxs...>)
 {
-  return (exp_text<Es, dimension_unit<typename Es::dimension>::symbol, negative_exp_count<Es...>, Idxs>() + ... +
-          basic_symbol_text(basic_fixed_string("")));
+  return symbol_text_join(
+    exp_text<Es, dimension_unit<typename Es::dimension>::symbol, negative_exp_count<Es...>, Idxs>()...);
 }
 
 template<typename... Es>
@@ -159,7 +161,7 @@ constexpr auto unit_text()
 
     constexpr auto prefix_txt =
       prefix_or_magnitude_text<U, U::mag / coherent_unit::mag, symbol_text.standard().size()>();
-    return prefix_txt + symbol_text;
+    return symbol_text_join(prefix_txt, symbol_text);
   }
 }
 
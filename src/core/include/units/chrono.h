@@ -29,6 +29,14 @@
 #include <chrono>
 // IWYU pragma: end_exports
 
+#include <units/quantity_cast.h>
+#include <units/quantity_point.h>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
 namespace units {
 
 template<typename Rep, typename Period>
@@ -97,4 +105,107 @@ template<typename C, typename U, typename Rep>
   return ret_type(to_std_duration(qp.relative()));
 }
 
+namespace detail {
+
+// the raw value of the time-stamp counter of the CPU (the virtual counter on ARM64)
+[[nodiscard]] inline std::uint64_t read_tsc() noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+  // the builtin avoids including `<x86intrin.h>` that brings all the SIMD intrinsics with it
+  return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+  std::uint64_t ticks;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief A clock reading the time-stamp counter of the CPU
+ *
+ * It has the epoch of `std::chrono::steady_clock` and counts the time with the ticks of the time-stamp counter
+ * (without a system call) converted to nanoseconds with a fixed-point factor. The time-stamp counter has to run at
+ * a constant rate (the invariant TSC of the modern x86-64 CPUs, the generic timer of ARM64).
+ *
+ * @warning The factor is calibrated against `std::chrono::steady_clock` on the first use, which busy-waits for
+ *          about 10 ms. Unless this is acceptable for the first `now()`, call `calibrate()` at the startup of
+ *          a program to keep it away from the timed code.
+ */
+struct tsc_clock {
+  using rep = std::int64_t;
+  using period = std::nano;
+  using duration = std::chrono::nanoseconds;
+  using time_point = std::chrono::time_point<tsc_clock>;
+  static constexpr bool is_steady = true;
+
+  // the ticks of the time-stamp counter at a point of time of `std::chrono::steady_clock` and their period in
+  // nanoseconds as a 32.32 fixed-point number
+  struct calibration {
+    std::uint64_t ticks;
+    rep nanoseconds;
+    std::uint64_t period;
+  };
+
+  /**
+   * @brief Calibrates the clock (only on the first call)
+   *
+   * Busy-waits for about 10 ms on the first call (also when it is made implicitly by the first `now()`) and returns
+   * immediately afterwards.
+   */
+  static const calibration& calibrate()
+  {
+    static const calibration c = [] {
+      using namespace std::chrono;
+      const auto start = steady_clock::now();
+      const std::uint64_t start_ticks = detail::read_tsc();
+      auto stop = start;
+      std::uint64_t stop_ticks = start_ticks;
+      while (stop - start < milliseconds(10)) {
+        stop = steady_clock::now();
+        stop_ticks = detail::read_tsc();
+      }
+      const auto ns = duration_cast<nanoseconds>(stop - start).count();
+      const auto ticks = static_cast<double>(stop_ticks - start_ticks);
+      return calibration{start_ticks, duration_cast<nanoseconds>(start.time_since_epoch()).count(),
+                         static_cast<std::uint64_t>(static_cast<double>(ns) / ticks * 0x1p32)};
+    }();
+    return c;
+  }
+
+  [[nodiscard]] static time_point now() noexcept
+  {
+    const calibration& c = calibrate();
+    // (ticks * period) >> 32 without the overflow of the 64-bit product
+    const std::uint64_t ticks = detail::read_tsc() - c.ticks;
+    const std::uint64_t ns = (ticks >> 32) * c.period + (((ticks & 0xffffffff) * c.period) >> 32);
+    return time_point(duration(c.nanoseconds + static_cast<rep>(ns)));
+  }
+};
+
+/**
+ * @brief The current time of a clock as a quantity point
+ *
+ * Equivalent to `quantity_point{C::now()}` converted to `quantity_point<clock_origin<C>, U, Rep>`, with the
+ * conversion factor from the period of the clock to `U` computed at compile time.
+ *
+ * @tparam C the clock (e.g. `std::chrono::steady_clock`, `std::chrono::system_clock`, `tsc_clock`)
+ * @tparam U the unit of the result (the period of the clock by default)
+ * @tparam Rep the representation of the result (the one of the clock by default)
+ */
+template<typename C, UnitOf<isq::si::dim_time> U = typename quantity_point_like_traits<typename C::time_point>::unit,
+         Representation Rep = TYPENAME C::rep>
+  requires std::chrono::is_clock_v<C>
+[[nodiscard]] quantity_point<clock_origin<C>, U, Rep> clock_now()
+{
+  using traits = quantity_point_like_traits<typename C::time_point>;
+  const quantity<isq::si::dim_time, typename traits::unit, typename traits::rep> d(C::now().time_since_epoch().count());
+  return quantity_point<clock_origin<C>, U, Rep>(quantity_cast<quantity<isq::si::dim_time, U, Rep>>(d));
+}
+
 }  // namespace units
@@ -0,0 +1,498 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// IWYU pragma: begin_exports
+#include <units/quantity_point.h>
+#include <units/quantity_point_kind.h>
+// IWYU pragma: end_exports
+
+#include <units/customization_points.h>
+#include <units/quantity_cast.h>
+#include <gsl/gsl-lite.hpp>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace units {
+
+namespace detail {
+
+// a sequence of bits packed into 64-bit words starting from the least significant bit of the first word
+class bit_stream {
+public:
+  // appends the lowest `n` bits (1 <= n <= 64) of `bits` (the remaining ones have to be zero)
+  void write(std::uint64_t bits, int n)
+  {
+    const std::size_t word = size_ / 64;
+    const auto offset = static_cast<int>(size_ % 64);
+    // one zero word more than needed, so that the reads of the last bits may look ahead
+    const std::size_t needed = word + (offset + n > 64 ? 3 : 2);
+    if (words_.size() < needed) words_.resize(needed);
+    words_[word] |= bits << offset;
+    if (offset + n > 64) words_[word + 1] |= bits >> (64 - offset);
+    size_ += static_cast<std::size_t>(n);
+  }
+
+  // the `n` bits (1 <= n <= 64) starting at the position `pos`
+  [[nodiscard]] std::uint64_t read(std::size_t pos, int n) const
+  {
+    const std::size_t word = pos / 64;
+    const auto offset = static_cast<int>(pos % 64);
+    std::uint64_t bits = words_[word] >> offset;
+    if (offset + n > 64) bits |= words_[word + 1] << (64 - offset);
+    return n == 64 ? bits : bits & ((std::uint64_t{1} << n) - 1);
+  }
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::size_t bytes() const { return words_.size() * sizeof(std::uint64_t); }
+
+  void clear()
+  {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+private:
+  std::vector<std::uint64_t> words_;
+  std::size_t size_ = 0;
+};
+
+// the two's complement arithmetic that wraps around instead of overflowing
+[[nodiscard]] constexpr std::int64_t wrapping_add(std::int64_t lhs, std::int64_t rhs)
+{
+  return static_cast<std::int64_t>(static_cast<std::uint64_t>(lhs) + static_cast<std::uint64_t>(rhs));
+}
+
+[[nodiscard]] constexpr std::int64_t wrapping_sub(std::int64_t lhs, std::int64_t rhs)
+{
+  return static_cast<std::int64_t>(static_cast<std::uint64_t>(lhs) - static_cast<std::uint64_t>(rhs));
+}
+
+template<typename T>
+inline constexpr bool is_point_ = QuantityPoint<T> || QuantityPointKind<T>;
+
+template<typename QP>
+[[nodiscard]] constexpr typename QP::quantity_type point_quantity(const QP& qp)
+{
+  if constexpr (QuantityPointKind<QP>)
+    return qp.relative().common();
+  else
+    return qp.relative();
+}
+
+/* the iteration over the points of a compressed series; `Codec` decodes the next point of a block from the bit
+ stream and keeps the state it needs for that
+ */
+template<typename Series, typename Codec>
+class compressed_series_iterator {
+public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+  using value_type = TYPENAME Series::value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type;
+
+  compressed_series_iterator() = default;
+  compressed_series_iterator(const Series* series, std::size_t index) : series_(series), index_(index)
+  {
+    if (index_ < series_->size()) start_block();
+  }
+
+  [[nodiscard]] value_type operator*() const { return Series::to_point(codec_.value()); }
+
+  compressed_series_iterator& operator++()
+  {
+    if (++index_ % Series::block_size == 0) {
+      if (index_ < series_->size()) start_block();
+    } else {
+      pos_ = codec_.decode(series_->stream_, pos_);
+    }
+    return *this;
+  }
+
+  compressed_series_iterator operator++(int)
+  {
+    compressed_series_iterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  [[nodiscard]] friend bool operator==(const compressed_series_iterator& lhs, const compressed_series_iterator& rhs)
+  {
+    return lhs.index_ == rhs.index_;
+  }
+
+private:
+  const Series* series_ = nullptr;
+  std::size_t index_ = 0;
+  std::size_t pos_ = 0;  // the position of the next point in the bit stream
+  Codec codec_;
+
+  void start_block()
+  {
+    const auto& b = series_->blocks_[index_ / Series::block_size];
+    pos_ = b.bit_offset;
+    codec_ = Codec(b.first);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A series of quantity points compressed with the delta-of-delta encoding of integral ticks
+ *
+ * Each point is stored as the number of integral ticks of `TickUnit` from its origin. The numbers of all the
+ * representation types are rounded to the nearest tick (halfway cases away from zero), so a series of a unit finer
+ * than `TickUnit` is lossy. The differences between the consecutive differences of the ticks
+ * are encoded with the variable-length codes of the "Gorilla" time series database (T. Pelkonen et al., "Gorilla: A
+ * Fast, Scalable, In-Memory Time Series Database"), so a series sampled at a regular rate takes a single bit per point.
+ *
+ * The points are grouped into blocks of `BlockSize` ones that start with the ticks of their first point, so a point
+ * is accessed by its index by decoding at most `BlockSize - 1` points, and the series is iterated by decoding each
+ * point once.
+ *
+ * @tparam QP the type of the quantity points (`quantity_point` or `quantity_point_kind`)
+ * @tparam TickUnit the unit of the ticks
+ * @tparam BlockSize the number of the points in a block
+ */
+template<typename QP, Unit TickUnit = TYPENAME QP::unit, std::size_t BlockSize = 128>
+  requires detail::is_point_<QP> && UnitOf<TickUnit, typename QP::dimension> && (BlockSize > 0)
+class delta_of_delta_series {
+  // the state of the decoding of a block
+  class codec {
+  public:
+    codec() = default;
+    explicit codec(std::int64_t first) : value_(first) {}
+
+    [[nodiscard]] std::int64_t value() const { return value_; }
+
+    static void encode(detail::bit_stream& stream, std::int64_t delta_of_delta)
+    {
+      const auto u = static_cast<std::uint64_t>(delta_of_delta);
+      const std::uint64_t z = (u << 1) ^ static_cast<std::uint64_t>(delta_of_delta >> 63);  // zigzag
+      if (z == 0)
+        stream.write(0b0, 1);
+      else if (z < (1 << 7))
+        stream.write(0b01 | (z << 2), 2 + 7);
+      else if (z < (1 << 9))
+        stream.write(0b011 | (z << 3), 3 + 9);
+      else if (z < (1 << 12))
+        stream.write(0b0111 | (z << 4), 4 + 12);
+      else {
+        stream.write(0b1111, 4);
+        stream.write(z, 64);
+      }
+    }
+
+    [[nodiscard]] std::size_t decode(const detail::bit_stream& stream, std::size_t pos)
+    {
+      // the number of the leading one bits selects the length of the code
+      static constexpr std::size_t prefix_bits[] = {1, 2, 3, 4, 4};
+      static constexpr int value_bits[] = {0, 7, 9, 12, 64};
+      const int k = std::countr_one(stream.read(pos, 4));
+      std::uint64_t z = 0;
+      if (k > 0) z = stream.read(pos + prefix_bits[k], value_bits[k]);
+      const auto delta_of_delta = static_cast<std::int64_t>((z >> 1) ^ (~(z & 1) + 1));
+      delta_ = detail::wrapping_add(delta_, delta_of_delta);
+      value_ = detail::wrapping_add(value_, delta_);
+      return pos + prefix_bits[k] + static_cast<std::size_t>(value_bits[k]);
+    }
+
+  private:
+    std::int64_t value_ = 0;
+    std::int64_t delta_ = 0;
+  };
+
+public:
+  using value_type = QP;
+  using size_type = std::size_t;
+  using tick_type = quantity<typename QP::dimension, TickUnit, std::int64_t>;
+  using const_iterator = detail::compressed_series_iterator<delta_of_delta_series, codec>;
+  using iterator = const_iterator;
+  static constexpr std::size_t block_size = BlockSize;
+
+  void push_back(const QP& qp)
+  {
+    const std::int64_t ticks = to_ticks(qp);
+    if (size_ % BlockSize == 0) {
+      blocks_.push_back({stream_.size(), ticks});
+      last_delta_ = 0;
+    } else {
+      // the wrapping arithmetic of the unsigned integers makes any sequence of ticks reversible
+      const std::int64_t delta = detail::wrapping_sub(ticks, last_);
+      codec::encode(stream_, detail::wrapping_sub(delta, last_delta_));
+      last_delta_ = delta;
+    }
+    last_ = ticks;
+    ++size_;
+  }
+
+  [[nodiscard]] QP operator[](size_type i) const
+  {
+    gsl_ExpectsAudit(i < size_);
+    const auto& b = blocks_[i / BlockSize];
+    codec c(b.first);
+    std::size_t pos = b.bit_offset;
+    for (std::size_t n = i % BlockSize; n > 0; --n) pos = c.decode(stream_, pos);
+    return to_point(c.value());
+  }
+
+  [[nodiscard]] QP front() const { return to_point(blocks_.front().first); }
+  [[nodiscard]] QP back() const { return to_point(last_); }
+
+  [[nodiscard]] const_iterator begin() const { return const_iterator(this, 0); }
+  [[nodiscard]] const_iterator end() const { return const_iterator(this, size_); }
+
+  [[nodiscard]] size_type size() const { return size_; }
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  // the memory taken by the encoded points
+  [[nodiscard]] std::size_t bytes() const { return stream_.bytes() + blocks_.size() * sizeof(block); }
+
+  void clear()
+  {
+    stream_.clear();
+    blocks_.clear();
+    size_ = 0;
+  }
+
+  void shrink_to_fit()
+  {
+    stream_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+  }
+
+private:
+  friend const_iterator;
+
+  struct block {
+    std::size_t bit_offset;
+    std::int64_t first;
+  };
+
+  detail::bit_stream stream_;
+  std::vector<block> blocks_;
+  size_type size_ = 0;
+  std::int64_t last_ = 0;
+  std::int64_t last_delta_ = 0;
+
+  // the numbers of all the representation types are rounded to the nearest tick (halfway cases away from zero)
+  [[nodiscard]] static std::int64_t to_ticks(const QP& qp)
+  {
+    const auto q = detail::point_quantity(qp);
+    if constexpr (requires { quantity_cast<tick_type>(q, rounding::half_away_from_zero); })
+      return quantity_cast<tick_type>(q, rounding::half_away_from_zero).number();
+    else
+      return static_cast<std::int64_t>(std::llround(quantity_cast<TickUnit>(quantity_cast<long double>(q)).number()));
+  }
+
+  [[nodiscard]] static QP to_point(std::int64_t ticks)
+  {
+    return QP(quantity_cast<typename QP::quantity_type>(tick_type(ticks)));
+  }
+};
+
+/**
+ * @brief A series of quantity points of a floating-point representation compressed with the XOR encoding
+ *
+ * The bits of each number are XOR-ed with the ones of the previous number and only the bits that differ are stored,
+ * as in the "Gorilla" time series database (T. Pelkonen et al., "Gorilla: A Fast, Scalable, In-Memory Time Series
+ * Database"). The encoding is lossless, and slowly changing values (e.g. an altitude sampled at a high rate) share
+ * the sign, the exponent, and the leading bits of the mantissa.
+ *
+ * The points are grouped into blocks of `BlockSize` ones that start with the number of their first point, so a point
+ * is accessed by its index by decoding at most `BlockSize - 1` points, and the series is iterated by decoding each
+ * point once.
+ *
+ * @tparam QP the type of the quantity points (`quantity_point` or `quantity_point_kind`)
+ * @tparam BlockSize the number of the points in a block
+ */
+template<typename QP, std::size_t BlockSize = 128>
+  requires detail::is_point_<QP> && std::floating_point<typename QP::rep> &&
+           (sizeof(typename QP::rep) == 4 || sizeof(typename QP::rep) == 8) && (BlockSize > 0)
+class xor_series {
+  using rep = TYPENAME QP::rep;
+  using bits_type = std::conditional_t<sizeof(rep) == 8, std::uint64_t, std::uint32_t>;
+  static constexpr int width = sizeof(rep) * 8;
+
+  // the state of the decoding of a block
+  class codec {
+  public:
+    codec() = default;
+    explicit codec(bits_type first) : value_(first) {}
+
+    [[nodiscard]] bits_type value() const { return value_; }
+
+    // encodes the next number (after `value_`) and moves to it
+    void encode(detail::bit_stream& stream, bits_type bits)
+    {
+      const bits_type x = bits ^ value_;
+      value_ = bits;
+      if (x == 0) {
+        stream.write(0b0, 1);
+        return;
+      }
+      const int leading = std::countl_zero(x);
+      const int trailing = std::countr_zero(x);
+      if (leading >= leading_ && trailing >= trailing_) {
+        // the differing bits fit into the window of the previous number
+        stream.write(0b01, 2);
+        stream.write(x >> trailing_, width - leading_ - trailing_);
+      } else {
+        leading_ = leading;
+        trailing_ = trailing;
+        const int length = width - leading - trailing;
+        stream.write(0b11 | (static_cast<std::uint64_t>(leading) << 2) | (static_cast<std::uint64_t>(length - 1) << 8),
+                     14);
+        stream.write(x >> trailing, length);
+      }
+    }
+
+    [[nodiscard]] std::size_t decode(const detail::bit_stream& stream, std::size_t pos)
+    {
+      const std::uint64_t prefix = stream.read(pos, 2);
+      if ((prefix & 1) == 0) return pos + 1;
+      if (prefix == 0b11) {
+        const std::uint64_t header = stream.read(pos + 2, 12);
+        leading_ = static_cast<int>(header & 0x3f);
+        trailing_ = width - leading_ - static_cast<int>(header >> 6) - 1;
+        pos += 12;
+      }
+      const int length = width - leading_ - trailing_;
+      value_ ^= static_cast<bits_type>(stream.read(pos + 2, length) << trailing_);
+      return pos + 2 + static_cast<std::size_t>(length);
+    }
+
+  private:
+    bits_type value_ = 0;
+    int leading_ = width;  // no window at the beginning of a block
+    int trailing_ = width;
+  };
+
+public:
+  using value_type = QP;
+  using size_type = std::size_t;
+  using const_iterator = detail::compressed_series_iterator<xor_series, codec>;
+  using iterator = const_iterator;
+  static constexpr std::size_t block_size = BlockSize;
+
+  void push_back(const QP& qp)
+  {
+    const auto bits = std::bit_cast<bits_type>(detail::point_quantity(qp).number());
+    if (size_ % BlockSize == 0) {
+      blocks_.push_back({stream_.size(), bits});
+      encoder_ = codec(bits);
+    } else {
+      encoder_.encode(stream_, bits);
+    }
+    ++size_;
+  }
+
+  [[nodiscard]] QP operator[](size_type i) const
+  {
+    gsl_ExpectsAudit(i < size_);
+    const auto& b = blocks_[i / BlockSize];
+    codec c(b.first);
+    std::size_t pos = b.bit_offset;
+    for (std::size_t n = i % BlockSize; n > 0; --n) pos = c.decode(stream_, pos);
+    return to_point(c.value());
+  }
+
+  [[nodiscard]] QP front() const { return to_point(blocks_.front().first); }
+  [[nodiscard]] QP back() const { return to_point(encoder_.value()); }
+
+  [[nodiscard]] const_iterator begin() const { return const_iterator(this, 0); }
+  [[nodiscard]] const_iterator end() const { return const_iterator(this, size_); }
+
+  [[nodiscard]] size_type size() const { return size_; }
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  // the memory taken by the encoded points
+  [[nodiscard]] std::size_t bytes() const { return stream_.bytes() + blocks_.size() * sizeof(block); }
+
+  void clear()
+  {
+    stream_.clear();
+    blocks_.clear();
+    size_ = 0;
+  }
+
+  void shrink_to_fit()
+  {
+    stream_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+  }
+
+private:
+  friend const_iterator;
+
+  struct block {
+    std::size_t bit_offset;
+    bits_type first;
+  };
+
+  detail::bit_stream stream_;
+  std::vector<block> blocks_;
+  size_type size_ = 0;
+  codec encoder_;
+
+  [[nodiscard]] static QP to_point(bits_type bits)
+  {
+    return QP(typename QP::quantity_type(std::bit_cast<rep>(bits)));
+  }
+};
+
+namespace detail {
+
+template<typename QP, std::size_t BlockSize>
+struct compressed_series_impl {
+  using type = delta_of_delta_series<QP, typename QP::unit, BlockSize>;
+};
+
+template<typename QP, std::size_t BlockSize>
+  requires std::floating_point<typename QP::rep>
+struct compressed_series_impl<QP, BlockSize> {
+  using type = xor_series<QP, BlockSize>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief A compressed series of quantity points
+ *
+ * The lossless XOR encoding of the numbers for the floating-point representations and the delta-of-delta encoding
+ * of the ticks of the unit of the points for the other ones.
+ */
+template<typename QP, std::size_t BlockSize = 128>
+  requires detail::is_point_<QP>
+using compressed_series = TYPENAME detail::compressed_series_impl<QP, BlockSize>::type;
+
+}  // namespace units
@@ -0,0 +1,343 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// IWYU pragma: begin_exports
+#include <units/generic/angle.h>
+#include <units/generic/dimensionless.h>
+#include <units/quantity.h>
+// IWYU pragma: end_exports
+
+#include <units/bits/constexpr_math.h>
+#include <units/magnitude.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Fast approximations of the trigonometric functions of angles
+ *
+ * The functions in this namespace trade the last few bits of accuracy of the `<cmath>` functions for speed.
+ * They evaluate range-reduced minimax approximations (coefficients of the Cephes Math Library by Stephen L. Moshier)
+ * and, unlike the functions in `units/math.h`, do not convert the angle to radians. Instead, the argument reduction
+ * and the polynomial coefficients are specialized at compile time for the unit of the angle:
+ * - units for which the quarter turn is a rational number (e.g. `degree`, `gradian`, `revolution`) are reduced
+ *   exactly with one multiply-subtract and the radian scaling is folded into the coefficients,
+ * - other units (e.g. `radian`) are reduced with a 3-part Cody-Waite reduction.
+ *
+ * Maximum errors measured against the `long double` `<cmath>` functions for angles of up to 100 revolutions
+ * (absolute for `sin` and `cos`, relative to `max(1, |tan|)` for `tan` with `|tan| <= 100`):
+ * | Function | `float`  | `double`  |
+ * |----------|---------:|----------:|
+ * | `sin`    | 1.1e-7   | 1.7e-16   |
+ * | `cos`    | 1.1e-7   | 1.7e-16   |
+ * | `tan`    | 2.7e-7   | 1.2e-15   |
+ * | `atan2`  | 3.5 ULP  | 2.7 ULP   |
+ *
+ * The reduction of the units with an irrational quarter turn uses its `long double` value, so the absolute error of
+ * the reduced argument grows with the number of turns (by about 1e-19 per turn).
+ *
+ * The products of the argument reduction are exact only for angles smaller than `2^(digits - b)` quarter turns in
+ * magnitude, where `digits` is `std::numeric_limits<Rep>::digits` and `b` is the number of the
+ * significant bits of the quarter turn in the unit (at most `digits / 2` bits of its leading part are used for the
+ * irrational ones). Other angles (and the non-finite ones) violate the precondition of `sin`, `cos`, and `tan` (use
+ * the functions of `units/math.h` for them). The valid ranges of the units of `units/generic/angle.h` are:
+ * | Unit         | `float`             | `double`            |
+ * |--------------|--------------------:|--------------------:|
+ * | `radian`     |   2^11 (2048) turns |  2^26 (6.7e7) turns |
+ * | `degree`     |  2^16 (65536) turns | 2^45 (3.5e13) turns |
+ * | `gradian`    | 2^17 (131072) turns | 2^46 (7.0e13) turns |
+ * | `revolution` |  2^20 (1.0e6) turns | 2^49 (5.6e14) turns |
+ *
+ * `long double` angles are computed with the `double` coefficients (so with at least the `double` accuracy).
+ */
+namespace units::fast {
+
+namespace detail {
+
+template<std::floating_point T>
+struct minimax_coefficients;
+
+template<>
+struct minimax_coefficients<float> {
+  // sin(x) = x * P(x^2) and cos(x) = Q(x^2) on [-pi/4, pi/4]
+  static constexpr std::array<long double, 4> sin = {1.L, -1.6666654611e-1L, 8.3321608736e-3L, -1.9515295891e-4L};
+  static constexpr std::array<long double, 5> cos = {1.L, -0.5L, 4.166664568298827e-2L, -1.388731625493765e-3L,
+                                                     2.443315711809948e-5L};
+  // atan(x) = x * P(x^2) on [-tan(pi/8), tan(pi/8)]
+  static constexpr long double atan_threshold = 0.4142135623730950488L;
+  static constexpr std::array<long double, 5> atan_num = {1.L, -3.33329491539e-1L, 1.99777106478e-1L,
+                                                          -1.38776856032e-1L, 8.05374449538e-2L};
+  static constexpr std::array<long double, 1> atan_den = {1.L};
+};
+
+template<>
+struct minimax_coefficients<double> {
+  // sin(x) = x * P(x^2) and cos(x) = Q(x^2) on [-pi/4, pi/4]
+  static constexpr std::array<long double, 7> sin = {
+    1.L, -1.66666666666666307295e-1L, 8.33333333332211858878e-3L, -1.98412698295895385996e-4L,
+    2.75573136213857245213e-6L, -2.50507477628578072866e-8L, 1.58962301576546568060e-10L};
+  static constexpr std::array<long double, 8> cos = {
+    1.L, -0.5L, 4.16666666666665929218e-2L, -1.38888888888730564116e-3L, 2.48015872888517045348e-5L,
+    -2.75573141792967388112e-7L, 2.08757008419747316778e-9L, -1.13585365213876817300e-11L};
+  // atan(x) = x * (1 + x^2 * P(x^2) / Q(x^2)) on [-0.66, 0.66]
+  static constexpr long double atan_threshold = 0.66L;
+  static constexpr std::array<long double, 5> atan_num = {
+    -6.485021904942025371773e1L, -1.228866684490136173410e2L, -7.500855792314704667340e1L,
+    -1.615753718733365076637e1L, -8.750608600031904122785e-1L};
+  static constexpr std::array<long double, 6> atan_den = {
+    1.945506571482613964425e2L, 4.853903996359136964868e2L, 4.328810604912902668951e2L,
+    1.650270098316988542046e2L, 2.485846490142306297962e1L, 1.L};
+};
+
+template<>
+struct minimax_coefficients<long double> : minimax_coefficients<double> {};
+
+/* the coefficients of P(x) scaled to P(scale * x) * factor (scale^(2i+Odd) * factor for the i-th coefficient) */
+template<std::floating_point T, bool Odd, std::size_t N>
+[[nodiscard]] constexpr std::array<T, N> scaled_coefficients(const std::array<long double, N>& c, long double scale,
+                                                             long double factor = 1) noexcept
+{
+  std::array<T, N> res{};
+  long double s = Odd ? scale * factor : factor;
+  for (std::size_t i = 0; i < N; ++i) {
+    res[i] = static_cast<T>(c[i] * s);
+    s *= scale * scale;
+  }
+  return res;
+}
+
+/* evaluates the polynomial with the Horner's scheme (coefficients ordered from the lowest power) */
+template<std::floating_point T, std::size_t N>
+[[nodiscard]] constexpr T horner(T x, const std::array<T, N>& c) noexcept
+{
+  // unrolled at compile time as the optimizers do not always unroll the loop
+  return [&]<std::size_t... I>(std::index_sequence<I...>) {
+    T res = c[N - 1];
+    ((res = res * x + c[N - 2 - I]), ...);
+    return res;
+  }(std::make_index_sequence<N - 1>{});
+}
+
+/* selects a or b and negates the result without branches (the quadrants of random angles are unpredictable) */
+template<std::floating_point T>
+[[nodiscard]] constexpr T select(bool first, bool negate, T a, T b) noexcept
+{
+  const std::array<T, 2> values = {a, b};
+  return values[first ? 0 : 1] * static_cast<T>(1 - 2 * static_cast<int>(negate));
+}
+
+/* keeps only the leading half of the significant bits of v so that its product with an integer is exact */
+template<std::floating_point T>
+[[nodiscard]] constexpr long double leading_bits(long double v) noexcept
+{
+  if (!(v > 0)) return 0;
+  int exponent = 0;
+  const long double m = ::units::detail::constexpr_frexp(v, exponent);
+  constexpr int bits = std::numeric_limits<T>::digits / 2;
+  const auto significant = static_cast<std::int64_t>(::units::detail::constexpr_ldexp(m, bits));
+  return static_cast<T>(::units::detail::constexpr_ldexp(static_cast<long double>(significant), exponent - bits));
+}
+
+/* the number of the bits of the significand of v from the leading to the trailing one (0 for v == 0) */
+[[nodiscard]] constexpr int significant_bits(long double v) noexcept
+{
+  if (!(v > 0)) return 0;
+  int exponent = 0;
+  long double m = ::units::detail::constexpr_frexp(v, exponent);
+  int bits = 0;
+  while (m != static_cast<long double>(static_cast<std::int64_t>(m))) {
+    m *= 2;
+    ++bits;
+  }
+  return bits;
+}
+
+template<Unit U, std::floating_point T>
+struct angle_traits {
+  using coefficients = minimax_coefficients<T>;
+
+  static constexpr Magnitude auto quarter_mag = mag<ratio{1, 4}>() * revolution::mag / U::mag;
+  static constexpr long double quarter = get_value<long double>(quarter_mag);
+  static constexpr bool exact_quarter =
+    is_rational(quarter_mag) && static_cast<long double>(static_cast<T>(quarter)) == quarter;
+
+  // radians in one unit
+  static constexpr long double scale = get_value<long double>(U::mag / radian::mag);
+
+  // Cody-Waite split of the quarter turn (exact for the rational ones)
+  static constexpr T quarter_hi = exact_quarter ? static_cast<T>(quarter) : static_cast<T>(leading_bits<T>(quarter));
+  static constexpr T quarter_mid =
+    exact_quarter ? T(0) : static_cast<T>(leading_bits<T>(quarter - static_cast<long double>(quarter_hi)));
+  static constexpr T quarter_lo =
+    exact_quarter
+      ? T(0)
+      : static_cast<T>(quarter - static_cast<long double>(quarter_hi) - static_cast<long double>(quarter_mid));
+  static constexpr T inv_quarter = static_cast<T>(1 / quarter);
+  static constexpr T round_magic =
+    static_cast<T>(1.5L * ::units::detail::constexpr_ldexp(1.L, std::numeric_limits<T>::digits - 1));
+  // the number of quarters for which the products of `reduce()` are exact (and the rounding with `round_magic`)
+  static constexpr int quarter_bits =
+    std::max({significant_bits(static_cast<long double>(quarter_hi)),
+              significant_bits(static_cast<long double>(quarter_mid) < 0 ? -static_cast<long double>(quarter_mid)
+                                                                         : static_cast<long double>(quarter_mid)),
+              2});
+  static constexpr T max_quarters =
+    static_cast<T>(::units::detail::constexpr_ldexp(1.L, std::numeric_limits<T>::digits - quarter_bits));
+
+  static constexpr auto sin = scaled_coefficients<T, true>(coefficients::sin, scale);
+  static constexpr auto cos = scaled_coefficients<T, false>(coefficients::cos, scale);
+
+  // atan returns the angle in this unit so the coefficients are scaled with the inverse of the radian scale
+  static constexpr T atan_threshold = static_cast<T>(coefficients::atan_threshold);
+  static constexpr auto atan_num = scaled_coefficients<T, false>(coefficients::atan_num, 1, 1 / scale);
+  static constexpr auto atan_den = scaled_coefficients<T, false>(coefficients::atan_den, 1);
+  static constexpr T inv_scale = static_cast<T>(1 / scale);
+  static constexpr T eighth = static_cast<T>(quarter / 2);
+
+  /* reduces v to r in [-quarter/2, quarter/2] such that v = r + k * quarter and returns k */
+  [[nodiscard]] static constexpr std::intmax_t reduce(T v, T& r) noexcept
+  {
+    const T t = v * inv_quarter;
+    gsl_Expects(t > -max_quarters && t < max_quarters);  // a finite angle in the valid range (see `units::fast`)
+    // rounding to the nearest integer by adding and subtracting a large power of 2
+    const T kk = (t + round_magic) - round_magic;
+    const auto k = static_cast<std::intmax_t>(kk);
+    if constexpr (exact_quarter)
+      r = v - kk * quarter_hi;
+    else
+      r = ((v - kk * quarter_hi) - kk * quarter_mid) - kk * quarter_lo;
+    return k;
+  }
+
+  [[nodiscard]] static constexpr T sin_poly(T r, T z) noexcept { return r * horner(z, sin); }
+  [[nodiscard]] static constexpr T cos_poly(T z) noexcept { return horner(z, cos); }
+
+  /* atan of t in [0, 1] expressed in this unit */
+  [[nodiscard]] static constexpr T atan(T t) noexcept
+  {
+    const bool reduced = t > atan_threshold;
+    const T base = select(!reduced, false, T(0), eighth);
+    t = select(!reduced, false, t, (t - 1) / (t + 1));
+    const T z = t * t;
+    if constexpr (atan_den.size() == 1)
+      return base + t * horner(z, atan_num);
+    else
+      return base + (t * inv_scale + t * z * horner(z, atan_num) / horner(z, atan_den));
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Computes the fast approximation of the sine of an angle
+ *
+ * @param q Finite angle of any unit in the valid range of its argument reduction (see @c units::fast)
+ * @return dimensionless<one, Rep> The sine of the angle (see @c units::fast for the maximum error)
+ */
+template<typename U, std::floating_point Rep>
+[[nodiscard]] constexpr dimensionless<one, Rep> sin(const angle<U, Rep>& q) noexcept
+{
+  using traits = detail::angle_traits<U, Rep>;
+  Rep r{};
+  const std::intmax_t k = traits::reduce(q.number(), r);
+  const Rep z = r * r;
+  // both of the polynomials are evaluated to not branch on the quadrant
+  const Rep s = traits::sin_poly(r, z);
+  const Rep c = traits::cos_poly(z);
+  return detail::select((k & 1) == 0, (k & 2) != 0, s, c);
+}
+
+/**
+ * @brief Computes the fast approximation of the cosine of an angle
+ *
+ * @param q Finite angle of any unit in the valid range of its argument reduction (see @c units::fast)
+ * @return dimensionless<one, Rep> The cosine of the angle (see @c units::fast for the maximum error)
+ */
+template<typename U, std::floating_point Rep>
+[[nodiscard]] constexpr dimensionless<one, Rep> cos(const angle<U, Rep>& q) noexcept
+{
+  using traits = detail::angle_traits<U, Rep>;
+  Rep r{};
+  const std::intmax_t k = traits::reduce(q.number(), r);
+  const Rep z = r * r;
+  const Rep s = traits::sin_poly(r, z);
+  const Rep c = traits::cos_poly(z);
+  return detail::select((k & 1) == 0, ((k + 1) & 2) != 0, c, s);
+}
+
+/**
+ * @brief Computes the fast approximation of the tangent of an angle
+ *
+ * @param q Finite angle of any unit in the valid range of its argument reduction (see @c units::fast)
+ * @return dimensionless<one, Rep> The tangent of the angle (see @c units::fast for the maximum error)
+ */
+template<typename U, std::floating_point Rep>
+[[nodiscard]] constexpr dimensionless<one, Rep> tan(const angle<U, Rep>& q) noexcept
+{
+  using traits = detail::angle_traits<U, Rep>;
+  Rep r{};
+  const std::intmax_t k = traits::reduce(q.number(), r);
+  const Rep z = r * r;
+  const Rep s = traits::sin_poly(r, z);
+  const Rep c = traits::cos_poly(z);
+  return detail::select((k & 1) == 0, (k & 1) != 0, s, c) / detail::select((k & 1) == 0, false, c, s);
+}
+
+/**
+ * @brief Computes the fast approximation of the angle between the positive x axis and the point (x, y)
+ *
+ * @tparam To Unit of the resulting angle (no conversion from radians is needed)
+ * @param y Y coordinate of the point
+ * @param x X coordinate of the point of the quantity type that has a common type with the one of y
+ * @return angle<To, Rep> The angle in [-pi, pi] (see @c units::fast for the maximum error)
+ */
+template<UnitOf<dim_angle<>> To = radian, Quantity Q1, Quantity Q2>
+  requires requires { typename std::common_type_t<Q1, Q2>; } &&
+           std::floating_point<typename std::common_type_t<Q1, Q2>::rep>
+[[nodiscard]] constexpr angle<To, typename std::common_type_t<Q1, Q2>::rep> atan2(const Q1& y, const Q2& x) noexcept
+{
+  using type = std::common_type_t<Q1, Q2>;
+  using rep = TYPENAME type::rep;
+  using traits = detail::angle_traits<To, rep>;
+  const rep yy = type(y).number();
+  const rep xx = type(x).number();
+  const rep ay = yy < 0 ? -yy : yy;
+  const rep ax = xx < 0 ? -xx : xx;
+  const bool swap = ay > ax;
+  const rep num = detail::select(!swap, false, ay, ax);
+  const rep den = detail::select(!swap, false, ax, ay);
+  // (0, 0) results in 0 and NaNs propagate
+  rep res = traits::atan(den > 0 ? num / den : num + den);
+  res = detail::select(!swap, false, res, 2 * traits::eighth - res);
+  res = detail::select(!(xx < 0), false, res, 4 * traits::eighth - res);
+  return angle<To, rep>(detail::select(true, yy < 0, res, res));
+}
+
+}  // namespace units::fast
@@ -0,0 +1,441 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/int128.h>
+#include <units/customization_points.h>
+#include <units/quantity_cast.h>
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace units {
+
+namespace detail {
+
+#if !defined(__SIZEOF_INT128__)
+// two's complement 128-bit integer for the compilers that do not provide one
+struct wide_int128 {
+  std::uint64_t hi;
+  std::uint64_t lo;
+
+  [[nodiscard]] static constexpr wide_int128 multiply(std::uint64_t a, std::uint64_t b)
+  {
+    const uint64_pair p = umul128(a, b);
+    return {p.hi, p.lo};
+  }
+
+  [[nodiscard]] constexpr wide_int128 operator-() const { return {~hi + (lo == 0), ~lo + 1}; }
+
+  [[nodiscard]] constexpr wide_int128 operator+(std::uint64_t v) const { return {hi + (lo + v < lo), lo + v}; }
+
+  // the lowest 64 bits of the quotient of the non-negative number and `d` (the binary long division)
+  [[nodiscard]] constexpr std::uint64_t divide(std::uint64_t d) const
+  {
+    std::uint64_t rem = 0;
+    std::uint64_t quotient = 0;
+    for (int i = 127; i >= 0; --i) {
+      const bool carry = rem >> 63;
+      rem = (rem << 1) | ((i >= 64 ? hi >> (i - 64) : lo >> i) & 1);
+      quotient <<= 1;
+      if (carry || rem >= d) {
+        rem -= d;
+        quotient |= 1;
+      }
+    }
+    return quotient;
+  }
+
+  // the lowest 64 bits of the number shifted right (arithmetically if `Signed`) by 0 < s < 128 bits
+  template<bool Signed>
+  [[nodiscard]] constexpr std::uint64_t shift_right(int s) const
+  {
+    if (s >= 64) {
+      if constexpr (Signed)
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(hi) >> (s - 64));
+      else
+        return hi >> (s - 64);
+    }
+    return (lo >> s) | (hi << (64 - s));
+  }
+};
+
+template<std::integral T>
+[[nodiscard]] constexpr std::uint64_t unsigned_magnitude(T v)
+{
+  const auto u = static_cast<std::uint64_t>(v);
+  if constexpr (std::is_signed_v<T>)
+    return v < 0 ? ~u + 1 : u;
+  else
+    return u;
+}
+#endif
+
+template<typename T>
+inline constexpr bool fixed_point_raw_ = std::integral<T> && !std::same_as<T, bool> && sizeof(T) <= 8;
+
+/*
+ * (a * b) >> Shift without overflowing the product; rounded to the nearest (ties upwards) if `Round`, rounded down
+ * otherwise. A negative `Shift` shifts to the left.
+ */
+template<int Shift, bool Round, std::integral A, std::integral B>
+  requires fixed_point_raw_<A> && fixed_point_raw_<B>
+[[nodiscard]] constexpr auto mul_shift(A a, B b)
+{
+  constexpr bool is_signed = std::is_signed_v<A> || std::is_signed_v<B>;
+  using result_type = std::conditional_t<is_signed, std::int64_t, std::uint64_t>;
+  constexpr auto round = [](auto product) {
+    if constexpr (Round && Shift > 0) product += decltype(product){1} << (Shift - 1);
+    return product;
+  };
+
+  if constexpr (Shift >= 127) {
+    return result_type{0};
+  } else if constexpr (sizeof(A) + sizeof(B) <= 8 && Shift < 64) {
+    if constexpr (Shift < 0)
+      return static_cast<result_type>(static_cast<result_type>(a) * static_cast<result_type>(b) << -Shift);
+    else
+      return static_cast<result_type>(round(static_cast<result_type>(a) * static_cast<result_type>(b)) >> Shift);
+  } else {
+#if defined(__SIZEOF_INT128__)
+    using wide = std::conditional_t<is_signed, int128_t, uint128_t>;
+    if constexpr (Shift < 0)
+      return static_cast<result_type>(static_cast<wide>(a) * static_cast<wide>(b) << -Shift);
+    else
+      return static_cast<result_type>(round(static_cast<wide>(a) * static_cast<wide>(b)) >> Shift);
+#else
+    wide_int128 product = wide_int128::multiply(unsigned_magnitude(a), unsigned_magnitude(b));
+    if constexpr (is_signed)
+      if ((a < 0) != (b < 0)) product = -product;
+    if constexpr (Shift <= 0)
+      return static_cast<result_type>(product.lo << -Shift);
+    else {
+      if constexpr (Round && Shift <= 64)
+        product = product + (std::uint64_t{1} << (Shift - 1));
+      else if constexpr (Round)
+        product.hi += std::uint64_t{1} << (Shift - 65);
+      return static_cast<result_type>(product.template shift_right<is_signed>(Shift));
+    }
+#endif
+  }
+}
+
+// (a << Shift) / b rounded toward zero without overflowing the dividend
+template<int Shift, std::integral T>
+  requires fixed_point_raw_<T>
+[[nodiscard]] constexpr T shift_divide(T a, T b)
+{
+  if constexpr (sizeof(T) <= 4) {
+    return static_cast<T>((static_cast<std::int64_t>(a) << Shift) / b);
+  } else {
+#if defined(__SIZEOF_INT128__)
+    using wide = std::conditional_t<std::is_signed_v<T>, int128_t, uint128_t>;
+    return static_cast<T>((static_cast<wide>(a) << Shift) / b);
+#else
+    const std::uint64_t ua = unsigned_magnitude(a);
+    const wide_int128 dividend{Shift == 0 ? 0 : ua >> (64 - Shift), ua << Shift};
+    const std::uint64_t q = dividend.divide(unsigned_magnitude(b));
+    if constexpr (std::is_signed_v<T>)
+      return static_cast<T>((a < 0) != (b < 0) ? ~q + 1 : q);
+    else
+      return static_cast<T>(q);
+#endif
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief A binary fixed-point number
+ *
+ * Stores the number `x` as the integer `x * 2^FracBits` (the Q format), so `fixed_point<std::int32_t, 16>` is the
+ * Q15.16 number with the resolution of 2^-16 and the range of [-2^15, 2^15). It can be used as a representation
+ * type of a quantity:
+ *
+ * @code{.cpp}
+ * using q15_16 = units::fixed_point<std::int32_t, 16>;
+ * auto d = units::isq::si::length<units::isq::si::metre, q15_16>(q15_16(1.5));
+ * auto mm = units::quantity_cast<units::isq::si::millimetre>(d);  // 1500 mm
+ * @endcode
+ *
+ * The unit conversions of `quantity_cast` multiply the underlying integers by an integral multiplier and shift the
+ * product right by a number of bits both precomputed from the conversion magnitude at compile time, so no floating
+ * point is involved. The result is rounded to the nearest representable number (the ties upwards).
+ *
+ * The arithmetic operations wrap around on overflow like the unsigned integers; the products and the quotients
+ * are rounded down and toward zero respectively.
+ *
+ * @tparam Int the underlying integer type (up to 64 bits)
+ * @tparam FracBits the number of the fractional bits
+ */
+template<std::integral Int, int FracBits>
+  requires detail::fixed_point_raw_<Int> && (FracBits >= 0) && (FracBits < std::numeric_limits<Int>::digits)
+class fixed_point {
+public:
+  using raw_type = Int;
+  static constexpr int fractional_bits = FracBits;
+
+  fixed_point() = default;
+
+  template<std::integral T>
+    requires detail::fixed_point_raw_<T>
+  constexpr fixed_point(T v) noexcept : raw_(static_cast<Int>(static_cast<Int>(v) << FracBits))
+  {
+  }
+
+  template<std::floating_point T>
+  constexpr explicit fixed_point(T v) noexcept :
+      raw_(static_cast<Int>(v * scale<T>() + (v < 0 ? T(-0.5) : T(0.5))))
+  {
+  }
+
+  // rescales the underlying integer (rounded down)
+  template<std::integral Int2, int FracBits2>
+  constexpr explicit fixed_point(const fixed_point<Int2, FracBits2>& v) noexcept :
+      raw_(static_cast<Int>(FracBits >= FracBits2 ? static_cast<Int>(v.raw()) << (FracBits - FracBits2)
+                                                  : static_cast<Int>(v.raw() >> (FracBits2 - FracBits))))
+  {
+  }
+
+  [[nodiscard]] static constexpr fixed_point from_raw(Int raw) noexcept
+  {
+    fixed_point f;
+    f.raw_ = raw;
+    return f;
+  }
+
+  [[nodiscard]] constexpr Int raw() const noexcept { return raw_; }
+
+  // the integral part (rounded down)
+  template<std::integral T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept
+  {
+    return static_cast<T>(raw_ >> FracBits);
+  }
+
+  template<std::floating_point T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept
+  {
+    return static_cast<T>(raw_) / scale<T>();
+  }
+
+  [[nodiscard]] constexpr fixed_point operator+() const noexcept { return *this; }
+  [[nodiscard]] constexpr fixed_point operator-() const noexcept { return from_raw(wrap(-wide(raw_))); }
+
+  constexpr fixed_point& operator+=(const fixed_point& rhs) noexcept
+  {
+    raw_ = wrap(wide(raw_) + wide(rhs.raw_));
+    return *this;
+  }
+
+  constexpr fixed_point& operator-=(const fixed_point& rhs) noexcept
+  {
+    raw_ = wrap(wide(raw_) - wide(rhs.raw_));
+    return *this;
+  }
+
+  constexpr fixed_point& operator*=(const fixed_point& rhs) noexcept
+  {
+    raw_ = static_cast<Int>(detail::mul_shift<FracBits, false>(raw_, rhs.raw_));
+    return *this;
+  }
+
+  constexpr fixed_point& operator/=(const fixed_point& rhs) noexcept
+  {
+    raw_ = static_cast<Int>(detail::shift_divide<FracBits>(raw_, rhs.raw_));
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator+(fixed_point lhs, const fixed_point& rhs) noexcept
+  {
+    return lhs += rhs;
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator-(fixed_point lhs, const fixed_point& rhs) noexcept
+  {
+    return lhs -= rhs;
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator*(fixed_point lhs, const fixed_point& rhs) noexcept
+  {
+    return lhs *= rhs;
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator/(fixed_point lhs, const fixed_point& rhs) noexcept
+  {
+    return lhs /= rhs;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const fixed_point&, const fixed_point&) = default;
+  [[nodiscard]] friend constexpr auto operator<=>(const fixed_point&, const fixed_point&) = default;
+
+private:
+  Int raw_ = 0;
+
+  template<std::floating_point T>
+  [[nodiscard]] static constexpr T scale()
+  {
+    return static_cast<T>(std::uint64_t{1} << FracBits);
+  }
+
+  // the arithmetic of the unsigned integers that wraps around instead of overflowing
+  [[nodiscard]] static constexpr std::uint64_t wide(Int v) { return static_cast<std::uint64_t>(v); }
+  [[nodiscard]] static constexpr Int wrap(std::uint64_t v) { return static_cast<Int>(v); }
+};
+
+/**
+ * @brief Values of fixed-point numbers are not treated as floating-point ones
+ *
+ * The conversions that may lose the fractional bits of the fixed-point numbers (e.g. from millimetres to metres)
+ * have to be explicit.
+ */
+template<std::integral Int, int FracBits>
+inline constexpr bool treat_as_floating_point<fixed_point<Int, FracBits>> = false;
+
+template<std::integral Int, int FracBits>
+struct quantity_values<fixed_point<Int, FracBits>> {
+  using rep = fixed_point<Int, FracBits>;
+  static constexpr rep zero() noexcept { return rep::from_raw(0); }
+  static constexpr rep one() noexcept { return rep(1); }
+  static constexpr rep min() noexcept { return rep::from_raw(std::numeric_limits<Int>::lowest()); }
+  static constexpr rep max() noexcept { return rep::from_raw(std::numeric_limits<Int>::max()); }
+};
+
+namespace detail {
+
+// the multiplier and the shift of the conversion of the fixed-point numbers
+struct fixed_point_multiplier {
+  std::uint64_t value;
+  int shift;
+};
+
+/*
+ * The integral multiplier `m` and the shift `s` such that `x * M * 2^Exp2 == (x * m) >> s` with the 63 significant bits
+ * of `m`, or with the exact `m` and `s <= 0` for an integral `M * 2^Exp2`. The rational magnitudes are divided exactly
+ * with the long division, so only the irrational ones use the floating-point approximation (at compile time).
+ */
+template<Magnitude auto M, int Exp2>
+[[nodiscard]] consteval fixed_point_multiplier get_fixed_point_multiplier()
+{
+  constexpr std::uint64_t low = std::uint64_t{1} << 62;
+  std::uint64_t m = 0;
+  int e = 0;  // M * 2^e == m
+  constexpr auto num = numerator(M);
+  constexpr auto den = denominator(M);
+  if constexpr (is_rational(M) && get_value<long double>(num) < 0x1p63L && get_value<long double>(den) < 0x1p63L) {
+    const auto d = static_cast<std::uint64_t>(get_value<std::intmax_t>(den));
+    auto n = static_cast<std::uint64_t>(get_value<std::intmax_t>(num));
+    m = n / d;
+    n %= d;
+    for (; m < low; ++e) {
+      n *= 2;  // n < d < 2^63
+      m = m * 2 + (n >= d);
+      if (n >= d) n -= d;
+    }
+    if (n * 2 >= d) ++m;
+  } else {
+    auto v = get_value<long double>(M);
+    for (; v < 0x1p62L; ++e) v *= 2;
+    for (; v >= 0x1p63L; --e) v /= 2;
+    m = static_cast<std::uint64_t>(v + 0.5L);
+  }
+  int shift = e - Exp2;
+  for (; shift > 0 && m % 2 == 0; --shift) m /= 2;
+  return {m, shift};
+}
+
+// the underlying integer of `x * M` converted from `FromFrac` to `ToFrac` fractional bits
+template<Magnitude auto M, int FromFrac, int ToFrac, std::integral To, std::integral From>
+[[nodiscard]] constexpr To scale_fixed_point(From x)
+{
+  constexpr fixed_point_multiplier c = get_fixed_point_multiplier<M, ToFrac - FromFrac>();
+  if constexpr (c.value <= std::numeric_limits<std::int32_t>::max() && sizeof(From) <= 4)
+    return static_cast<To>(mul_shift<c.shift, true>(x, static_cast<std::int32_t>(c.value)));
+  else
+    return static_cast<To>(mul_shift<c.shift, true>(x, c.value));
+}
+
+template<typename T>
+inline constexpr bool is_fixed_point_ = false;
+
+template<std::integral Int, int FracBits>
+inline constexpr bool is_fixed_point_<fixed_point<Int, FracBits>> = true;
+
+template<typename T>
+concept fixed_point_castable_ = fixed_point_raw_<T> || std::floating_point<T>;
+
+template<std::integral Int1, int FracBits1, std::integral Int2, int FracBits2>
+struct cast_traits<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>> {
+  template<Magnitude auto M>
+  [[nodiscard]] static constexpr fixed_point<Int2, FracBits2> scale(const fixed_point<Int1, FracBits1>& v)
+  {
+    return fixed_point<Int2, FracBits2>::from_raw(scale_fixed_point<M, FracBits1, FracBits2, Int2>(v.raw()));
+  }
+};
+
+template<std::integral Int, int FracBits, fixed_point_castable_ To>
+struct cast_traits<fixed_point<Int, FracBits>, To> {
+  template<Magnitude auto M>
+  [[nodiscard]] static constexpr To scale(const fixed_point<Int, FracBits>& v)
+  {
+    if constexpr (std::floating_point<To>)
+      return static_cast<To>(v) * get_value<To>(M);
+    else
+      return scale_fixed_point<M, FracBits, 0, To>(v.raw());
+  }
+};
+
+template<fixed_point_castable_ From, std::integral Int, int FracBits>
+struct cast_traits<From, fixed_point<Int, FracBits>> {
+  template<Magnitude auto M>
+  [[nodiscard]] static constexpr fixed_point<Int, FracBits> scale(const From& v)
+  {
+    if constexpr (std::floating_point<From>)
+      return fixed_point<Int, FracBits>(v * get_value<From>(M));
+    else
+      return fixed_point<Int, FracBits>::from_raw(scale_fixed_point<M, 0, FracBits, Int>(v));
+  }
+};
+
+}  // namespace detail
+
+}  // namespace units
+
+template<std::integral Int1, int FracBits1, std::integral Int2, int FracBits2>
+struct std::common_type<units::fixed_point<Int1, FracBits1>, units::fixed_point<Int2, FracBits2>> {
+  using type = units::fixed_point<std::common_type_t<Int1, Int2>, std::max(FracBits1, FracBits2)>;
+};
+
+template<std::integral Int, int FracBits, std::floating_point T>
+struct std::common_type<units::fixed_point<Int, FracBits>, T> {
+  using type = T;
+};
+
+template<std::floating_point T, std::integral Int, int FracBits>
+struct std::common_type<T, units::fixed_point<Int, FracBits>> {
+  using type = T;
+};
@@ -0,0 +1,139 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// IWYU pragma: begin_exports
+#include <units/quantity.h>
+// IWYU pragma: end_exports
+
+#include <units/magnitude.h>
+#include <units/quantity_cast.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace units {
+
+/**
+ * @brief Interpolation between the samples of a @c lookup_table
+ */
+enum class interpolation {
+  linear,  ///< piecewise linear
+  cubic    ///< Catmull-Rom spline (C1 continuous, exact for quadratic functions inside the interval)
+};
+
+/**
+ * @brief A function of a quantity sampled at equidistant points of an interval
+ *
+ * The table is filled by the constructor so a `constexpr` table samples the function at compile time and stores
+ * only the numbers of the results. For example:
+ *
+ * constexpr lookup_table<speed<kilometre_per_hour>, speed<metre_per_second>, 64> sink_rate(polar, 70_q_km_per_h,
+ *                                                                                            250_q_km_per_h);
+ *
+ * The table is evaluated for quantities of any unit of the input dimension. The conversion of the argument to the unit
+ * of the table is folded into the factor that maps it to the position in the table, and the samples are selected and
+ * interpolated without branching on the position in the table. Arguments outside of the interval evaluate to the value
+ * at the nearest end of it.
+ *
+ * @tparam In the quantity type of the argument (the interval and the samples are expressed in its unit)
+ * @tparam Out the quantity type of the results
+ * @tparam N the number of samples (the first and the last one are at the ends of the interval)
+ * @tparam Interp the interpolation between the samples
+ */
+template<Quantity In, Quantity Out, std::size_t N, interpolation Interp = interpolation::linear>
+  requires(N >= 2) && std::floating_point<typename In::rep> && std::floating_point<typename Out::rep>
+class lookup_table {
+public:
+  using input_type = In;
+  using output_type = Out;
+  using rep = TYPENAME Out::rep;
+  static constexpr std::size_t size = N;
+
+private:
+  using in_rep = TYPENAME In::rep;
+
+  in_rep first_;
+  in_rep last_;
+  in_rep inv_step_;
+  std::array<rep, N> values_{};
+
+public:
+  /**
+   * @brief Samples the function at N equidistant points of [first, last]
+   *
+   * @param f the function to sample (has to be usable in a constant expression for a `constexpr` table)
+   * @param first the beginning of the interval
+   * @param last the end of the interval (greater than first)
+   */
+  template<std::invocable<const In&> F>
+    requires std::constructible_from<Out, std::invoke_result_t<F, const In&>>
+  constexpr lookup_table(F f, const In& first, const In& last) :
+      first_(first.number()), last_(last.number()), inv_step_(static_cast<in_rep>(N - 1) / (last_ - first_))
+  {
+    gsl_Expects(first_ < last_);
+    const in_rep step = (last_ - first_) / static_cast<in_rep>(N - 1);
+    for (std::size_t i = 0; i < N - 1; ++i)
+      values_[i] = Out(f(In(first_ + static_cast<in_rep>(i) * step))).number();
+    values_[N - 1] = Out(f(last)).number();
+  }
+
+  [[nodiscard]] constexpr In first() const noexcept { return In(first_); }
+  [[nodiscard]] constexpr In last() const noexcept { return In(last_); }
+  [[nodiscard]] constexpr const std::array<rep, N>& values() const noexcept { return values_; }
+
+  /**
+   * @brief Interpolates the function at q
+   *
+   * @param q the argument of any unit of the input dimension
+   */
+  template<QuantityEquivalentTo<In> Q>
+  [[nodiscard]] constexpr Out operator()(const Q& q) const noexcept
+  {
+    // the position in the table is q * (c / step) - first / step where c converts Q to In
+    constexpr in_rep c = get_value<in_rep>(detail::cast_magnitude<Q, In>);
+    in_rep t = static_cast<in_rep>(q.number()) * (c * inv_step_) - first_ * inv_step_;
+    // clamped to the interval (NaN maps to the first sample)
+    t = std::min(std::max(in_rep(0), t), static_cast<in_rep>(N - 1));
+    const std::ptrdiff_t k = std::min(static_cast<std::ptrdiff_t>(t), static_cast<std::ptrdiff_t>(N - 2));
+    const auto x = static_cast<rep>(t - static_cast<in_rep>(k));
+    const auto i = static_cast<std::size_t>(k);
+
+    const rep y1 = values_[i];
+    const rep y2 = values_[i + 1];
+    if constexpr (Interp == interpolation::linear) {
+      return Out(y1 + x * (y2 - y1));
+    } else {
+      // the samples out of the table are replaced with the nearest ones
+      const rep y0 = values_[i - static_cast<std::size_t>(i > 0)];
+      const rep y3 = values_[i + 1 + static_cast<std::size_t>(i < N - 2)];
+      return Out(y1 + rep(0.5) * x *
+                        (y2 - y0 + x * (2 * y0 - 5 * y1 + 4 * y2 - y3 + x * (3 * (y1 - y2) + y3 - y0))));
+    }
+  }
+};
+
+}  // namespace units
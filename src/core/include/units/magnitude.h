@@ -181,18 +181,49 @@ constexpr T int_power(T base, std::integral auto exp)
 }
 
 
+// Compute the `n`-th root of a positive `x` at compile time (to the full precision of `long double`).
+//
+// Newton iterations started above the root decrease monotonically (`r^n` is convex), so the iterations stop once
+// they no longer decrease, which leaves the result within 1 ULP of the exact root.
+constexpr long double int_root(long double x, std::intmax_t n)
+{
+  if (!(x > 0) || n <= 0) {
+    std::terminate();  // Only positive numbers and roots are supported
+  }
+  UNITS_DIAGNOSTIC_PUSH
+  UNITS_DIAGNOSTIC_IGNORE_FLOAT_EQUAL
+  if (n == 1 || x == 1) {
+    return x;
+  }
+  UNITS_DIAGNOSTIC_POP
+  if (x < 1) {
+    return 1 / int_root(1 / x, n);
+  }
+
+  // Plain multiplications as `int_power` would detect the inexact products of the iterations as a wraparound.
+  const auto power = [](long double base, std::intmax_t exp) {
+    long double result = 1;
+    for (std::intmax_t i = 0; i < exp; ++i) result *= base;
+    return result;
+  };
+
+  // Bernoulli's inequality guarantees that `1 + (x - 1) / n` is not below the root.
+  long double r = 1 + (x - 1) / static_cast<long double>(n);
+  while (true) {
+    const long double r_pow = power(r, n - 1);
+    const long double next = r - (r_pow * r - x) / (static_cast<long double>(n) * r_pow);
+    if (!(next < r)) {
+      return r;
+    }
+    r = next;
+  }
+}
+
 template<typename T>
 constexpr widen_t<T> compute_base_power(BasePower auto bp)
 {
-  // This utility can only handle integer powers.  To compute rational powers at compile time, we'll
-  // need to write a custom function.
-  //
   // Note that since this function should only be called at compile time, the point of these
   // terminations is to act as "static_assert substitutes", not to actually terminate at runtime.
-  if (bp.power.den != 1) {
-    std::terminate();  // Rational powers not yet supported
-  }
-
   if (bp.power.num < 0) {
     if constexpr (std::is_integral_v<T>) {
       std::terminate();  // Cannot represent reciprocal as integer
@@ -201,6 +232,18 @@ constexpr widen_t<T> compute_base_power(BasePower auto bp)
     }
   }
 
+  if (bp.power.den != 1) {
+    if constexpr (!std::is_floating_point_v<T>) {
+      std::terminate();  // Rational powers are only computed for floating-point types
+    } else {
+      // base^(num/den) = base^q * (base^r)^(1/den), where num = q * den + r, keeps the argument of the root small
+      const auto q = bp.power.num / bp.power.den;
+      const auto r = bp.power.num % bp.power.den;
+      const auto base = static_cast<widen_t<T>>(bp.get_base());
+      return int_power(base, q) * static_cast<widen_t<T>>(int_root(int_power(base, r), bp.power.den));
+    }
+  }
+
   auto power = bp.power.num;
   return int_power(static_cast<widen_t<T>>(bp.get_base()), power);
 }
@@ -22,8 +22,10 @@
 
 #pragma once
 
+#include <units/bits/constexpr_math.h>
 #include <units/bits/dimension_op.h>
 #include <units/bits/external/hacks.h>
+#include <units/bits/pow.h>
 #include <units/generic/angle.h>
 #include <units/generic/dimensionless.h>
 #include <units/quantity.h>
@@ -32,17 +34,230 @@
 // IWYU pragma: begin_exports
 #include <cmath>
 #include <cstdint>
+#include <span>
 // IWYU pragma: end_exports
 
+#include <gsl/gsl-lite.hpp>
+#include <array>
+#include <cstddef>
 #include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace units {
 
+namespace detail {
+
+// `<cmath>` functions compute integral arguments as `double`
+template<typename Rep>
+using math_result_t = std::conditional_t<std::floating_point<Rep>, Rep, double>;
+
+// the below use `<cmath>` (or the functions found with ADL for user-defined types) at runtime
+// and fall back to the implementations from `bits/constexpr_math.h` during constant evaluation
+
+template<typename Rep>
+[[nodiscard]] constexpr auto sqrt_number(const Rep& v) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated()) return constexpr_sqrt(static_cast<math_result_t<Rep>>(v));
+  using std::sqrt;
+  return sqrt(v);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto cbrt_number(const Rep& v) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated()) return constexpr_cbrt(static_cast<math_result_t<Rep>>(v));
+  using std::cbrt;
+  return cbrt(v);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto exp_number(const Rep& v)
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated())
+      return constexpr_exp(static_cast<math_result_t<Rep>>(v));
+  using std::exp;
+  return exp(v);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto abs_number(const Rep& v) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated()) return detail::abs(v);
+  using std::abs;
+  return abs(v);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto hypot_number(const Rep& x, const Rep& y) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated())
+      return constexpr_hypot(static_cast<math_result_t<Rep>>(x), static_cast<math_result_t<Rep>>(y));
+  using std::hypot;
+  return hypot(x, y);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto hypot_number(const Rep& x, const Rep& y, const Rep& z) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated())
+      return constexpr_hypot(static_cast<math_result_t<Rep>>(x), static_cast<math_result_t<Rep>>(y),
+                             static_cast<math_result_t<Rep>>(z));
+  using std::hypot;
+  return hypot(x, y, z);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto sin_number(const Rep& v) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated()) return constexpr_sin(static_cast<math_result_t<Rep>>(v));
+  using std::sin;
+  return sin(v);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto cos_number(const Rep& v) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated()) return constexpr_cos(static_cast<math_result_t<Rep>>(v));
+  using std::cos;
+  return cos(v);
+}
+
+template<typename Rep>
+[[nodiscard]] constexpr auto tan_number(const Rep& v) noexcept
+{
+  if constexpr (std::is_arithmetic_v<Rep>)
+    if (std::is_constant_evaluated()) return constexpr_tan(static_cast<math_result_t<Rep>>(v));
+  using std::tan;
+  return tan(v);
+}
+
+// computes both the sine and the cosine of v with the same results as `sin_number()` and `cos_number()`
+// (only one range reduction of v is done in the constant evaluation)
+template<typename Rep>
+[[nodiscard]] constexpr auto sincos_number(const Rep& v) noexcept
+{
+  if constexpr (std::floating_point<Rep>) {
+    if (std::is_constant_evaluated()) {
+      // the reduction constants are not exact in the narrower types
+      using T = std::conditional_t<(sizeof(Rep) < sizeof(double)), double, Rep>;
+      const auto x = static_cast<T>(v);
+      if (!is_finite(x)) return std::pair{static_cast<Rep>(sin_number(x)), static_cast<Rep>(cos_number(x))};
+
+      T r{};
+      const std::intmax_t quadrant = reduce_half_pi(x, r);
+      const T s = sin_taylor(r);
+      const T c = cos_taylor(r);
+      switch (quadrant & 3) {
+        case 0: return std::pair{static_cast<Rep>(s), static_cast<Rep>(c)};
+        case 1: return std::pair{static_cast<Rep>(c), static_cast<Rep>(-s)};
+        case 2: return std::pair{static_cast<Rep>(-s), static_cast<Rep>(-c)};
+        default: return std::pair{static_cast<Rep>(-c), static_cast<Rep>(s)};
+      }
+    }
+  }
+  // at runtime the C library functions are used (the compilers fuse such a pair of calls into one `sincos()`)
+  return std::pair{sin_number(v), cos_number(v)};
+}
+
+// the number of a `From` quantity converted to the number of a `To` quantity with a factor computed at compile time
+template<Quantity From, Quantity To>
+[[nodiscard]] constexpr auto scale_number(const typename From::rep& v)
+{
+  using rep = TYPENAME To::rep;
+  if constexpr (std::same_as<typename From::unit, typename To::unit>) {
+    return static_cast<rep>(v);
+  } else {
+    constexpr rep factor = get_value<rep>(cast_magnitude<From, To>);
+    return static_cast<rep>(static_cast<rep>(v) * factor);
+  }
+}
+
+// the Euclidean norm of `size` floating-point numbers (of the same unit) returned by `value(i)`
+// the sum of the squares is computed directly when it neither overflows nor loses the precision because of underflow,
+// otherwise the numbers are scaled by the largest of them
+template<typename Rep, typename F>
+[[nodiscard]] constexpr Rep norm_number(std::size_t size, F value) noexcept
+{
+  Rep sum{};
+  for (std::size_t i = 0; i < size; ++i) {
+    const Rep v = value(i);
+    sum += v * v;
+  }
+  if constexpr (std::floating_point<Rep>) {
+    constexpr Rep lower = std::numeric_limits<Rep>::min() / std::numeric_limits<Rep>::epsilon();
+    if (!(sum >= lower && sum <= std::numeric_limits<Rep>::max())) {
+      Rep max{};
+      for (std::size_t i = 0; i < size; ++i) {
+        Rep v = value(i);
+        if (v < 0) v = -v;
+        if (v > max) max = v;
+      }
+      // zeros and NaNs return the sum and infinities return infinity (like `std::hypot`, even with NaNs)
+      if (!(max > 0)) return sum;
+      if (max > std::numeric_limits<Rep>::max()) return max;
+      Rep scaled{};
+      for (std::size_t i = 0; i < size; ++i) {
+        const Rep v = value(i) / max;
+        scaled += v * v;
+      }
+      return static_cast<Rep>(sqrt_number(scaled) * max);
+    }
+  }
+  return static_cast<Rep>(sqrt_number(sum));
+}
+
+// the root is taken before raising to the power so that the intermediate result does not overflow or underflow
+// for numbers whose result is representable
+template<std::intmax_t Num, std::intmax_t Den, typename Rep>
+[[nodiscard]] constexpr Rep pow_number(const Rep& v) noexcept
+{
+  if constexpr (Den == 1) {
+    if constexpr (Num > 0)
+      return pow_impl<Num>(v);
+    else
+      return static_cast<Rep>(Rep(1) / pow_impl<-Num>(v));
+  } else if constexpr (Den == 2) {
+    if constexpr (Num == 1)
+      return static_cast<Rep>(sqrt_number(v));
+    else
+      return static_cast<Rep>(pow_number<Num, 1>(sqrt_number(v)));
+  } else if constexpr (Den == 3) {
+    if constexpr (Num == 1)
+      return static_cast<Rep>(cbrt_number(v));
+    else
+      return static_cast<Rep>(pow_number<Num, 1>(cbrt_number(v)));
+  } else {
+    constexpr double exponent = static_cast<double>(Num) / static_cast<double>(Den);
+    if constexpr (std::is_arithmetic_v<Rep>)
+      if (std::is_constant_evaluated()) {
+        using T = math_result_t<Rep>;
+        return static_cast<Rep>(constexpr_pow(static_cast<T>(v), static_cast<T>(exponent)));
+      }
+    using std::pow;
+    return static_cast<Rep>(pow(v, exponent));
+  }
+}
+
+}  // namespace detail
+
 /**
  * @brief Computes the value of a quantity raised to the power `N`
  *
  * Both the quantity value and its dimension are the base of the operation.
  *
+ * Integral exponents are computed with a compile-time chain of multiplications (which is `constexpr` and exact
+ * for integral representation types), exponents with a denominator of `2` or `3` use `sqrt` or `cbrt`, and only
+ * the remaining ones fall back to `pow`.
+ *
  * @tparam Num Exponent numerator
  * @tparam Den Exponent denominator
  * @param q Quantity being the base of the operation
@@ -50,18 +265,20 @@ namespace units {
  */
 template<std::intmax_t Num, std::intmax_t Den = 1, Quantity Q>
   requires detail::non_zero<Den>
-[[nodiscard]] inline auto pow(const Q& q) noexcept
-  requires requires { pow(q.number(), 1.0); } || requires { std::pow(q.number(), 1.0); }
+[[nodiscard]] constexpr auto pow(const Q& q) noexcept
+  requires(ratio{Num, Den}.den == 1 && requires { q.number() * q.number(); }) ||
+          (ratio{Num, Den}.den == 2 && (requires { sqrt(q.number()); } || requires { std::sqrt(q.number()); })) ||
+          (ratio{Num, Den}.den == 3 && (requires { cbrt(q.number()); } || requires { std::cbrt(q.number()); })) ||
+          requires { pow(q.number(), 1.0); } || requires { std::pow(q.number(), 1.0); }
 {
   using rep = TYPENAME Q::rep;
-  if constexpr (Num == 0) {
+  constexpr ratio r{Num, Den};
+  if constexpr (r.num == 0) {
     return rep(1);
   } else {
-    using dim = dimension_pow<typename Q::dimension, Num, Den>;
-    using unit = downcast_unit<dim, pow<ratio{Num, Den}>(Q::reference.mag) / dim::mag>;
-    using std::pow;
-    return quantity<dim, unit, rep>(
-      static_cast<rep>(pow(q.number(), static_cast<double>(Num) / static_cast<double>(Den))));
+    using dim = dimension_pow<typename Q::dimension, r.num, r.den>;
+    using unit = downcast_unit<dim, pow<r>(Q::reference.mag) / dim::mag>;
+    return quantity<dim, unit, rep>(detail::pow_number<r.num, r.den>(q.number()));
   }
 }
 
@@ -74,14 +291,13 @@ template<std::intmax_t Num, std::intmax_t Den = 1, Quantity Q>
  * @return Quantity The result of computation
  */
 template<Quantity Q>
-[[nodiscard]] inline Quantity auto sqrt(const Q& q) noexcept
+[[nodiscard]] constexpr Quantity auto sqrt(const Q& q) noexcept
   requires requires { sqrt(q.number()); } || requires { std::sqrt(q.number()); }
 {
   using dim = dimension_pow<typename Q::dimension, 1, 2>;
   using unit = downcast_unit<dim, pow<ratio{1, 2}>(Q::reference.mag) / dim::mag>;
   using rep = TYPENAME Q::rep;
-  using std::sqrt;
-  return quantity<dim, unit, rep>(static_cast<rep>(sqrt(q.number())));
+  return quantity<dim, unit, rep>(static_cast<rep>(detail::sqrt_number(q.number())));
 }
 
 /**
@@ -93,14 +309,13 @@ template<Quantity Q>
  * @return Quantity The result of computation
  */
 template<Quantity Q>
-[[nodiscard]] inline Quantity auto cbrt(const Q& q) noexcept
+[[nodiscard]] constexpr Quantity auto cbrt(const Q& q) noexcept
   requires requires { cbrt(q.number()); } || requires { std::cbrt(q.number()); }
 {
   using dim = dimension_pow<typename Q::dimension, 1, 3>;
   using unit = downcast_unit<dim, pow<ratio{1, 3}>(Q::reference.mag) / dim::mag>;
   using rep = TYPENAME Q::rep;
-  using std::cbrt;
-  return quantity<dim, unit, rep>(static_cast<rep>(cbrt(q.number())));
+  return quantity<dim, unit, rep>(static_cast<rep>(detail::cbrt_number(q.number())));
 }
 
 /**
@@ -112,11 +327,10 @@ template<Quantity Q>
  * @return Quantity The value of the same quantity type
  */
 template<typename U, typename Rep>
-[[nodiscard]] inline dimensionless<U, Rep> exp(const dimensionless<U, Rep>& q)
+[[nodiscard]] constexpr dimensionless<U, Rep> exp(const dimensionless<U, Rep>& q)
   requires requires { exp(q.number()); } || requires { std::exp(q.number()); }
 {
-  using std::exp;
-  return quantity_cast<U>(dimensionless<one, Rep>(exp(quantity_cast<one>(q).number())));
+  return quantity_cast<U>(dimensionless<one, Rep>(detail::exp_number(quantity_cast<one>(q).number())));
 }
 
 /**
@@ -126,11 +340,10 @@ template<typename U, typename Rep>
  * @return Quantity The absolute value of a provided quantity
  */
 template<typename D, typename U, typename Rep>
-[[nodiscard]] inline quantity<D, U, Rep> abs(const quantity<D, U, Rep>& q) noexcept
+[[nodiscard]] constexpr quantity<D, U, Rep> abs(const quantity<D, U, Rep>& q) noexcept
   requires requires { abs(q.number()); } || requires { std::abs(q.number()); }
 {
-  using std::abs;
-  return quantity<D, U, Rep>(abs(q.number()));
+  return quantity<D, U, Rep>(detail::abs_number(q.number()));
 }
 
 /**
@@ -179,6 +392,8 @@ template<Unit To, typename D, typename U, typename Rep>
   } else {
     if constexpr (std::is_same_v<To, U>) {
       return q;
+    } else if constexpr (requires { quantity_cast<To>(q, rounding::floor); }) {
+      return quantity_cast<To>(q, rounding::floor);
     } else {
       return handle_signed_results(quantity_cast<To>(q));
     }
@@ -228,6 +443,8 @@ template<Unit To, typename D, typename U, typename Rep>
   } else {
     if constexpr (std::is_same_v<To, U>) {
       return q;
+    } else if constexpr (requires { quantity_cast<To>(q, rounding::ceil); }) {
+      return quantity_cast<To>(q, rounding::ceil);
     } else {
       return handle_signed_results(quantity_cast<To>(q));
     }
@@ -271,6 +488,8 @@ template<Unit To, typename D, typename U, typename Rep>
     } else {
       return q;
     }
+  } else if constexpr (!treat_as_floating_point<Rep> && requires { quantity_cast<To>(q, rounding::half_to_even); }) {
+    return quantity_cast<To>(q, rounding::half_to_even);
   } else {
     const auto res_low = units::floor<To>(q);
     const auto res_high = res_low + decltype(res_low)::one();
@@ -307,7 +526,7 @@ template<Quantity To, std::same_as<typename To::dimension> D, typename U, std::s
  *        without undue overflow or underflow at intermediate stages of the computation
  */
 template<Quantity Q1, Quantity Q2>
-[[nodiscard]] inline std::common_type_t<Q1, Q2> hypot(const Q1& x, const Q2& y) noexcept
+[[nodiscard]] constexpr std::common_type_t<Q1, Q2> hypot(const Q1& x, const Q2& y) noexcept
   requires requires { typename std::common_type_t<Q1, Q2>; } && requires(std::common_type_t<Q1, Q2> q) {
     requires requires { hypot(q.number(), q.number()); } || requires { std::hypot(q.number(), q.number()); };
   }
@@ -315,8 +534,7 @@ template<Quantity Q1, Quantity Q2>
   using type = std::common_type_t<Q1, Q2>;
   type xx = x;
   type yy = y;
-  using std::hypot;
-  return type(hypot(xx.number(), yy.number()));
+  return type(detail::hypot_number(xx.number(), yy.number()));
 }
 
 /**
@@ -324,7 +542,7 @@ template<Quantity Q1, Quantity Q2>
  *        without undue overflow or underflow at intermediate stages of the computation
  */
 template<Quantity Q1, Quantity Q2, Quantity Q3>
-[[nodiscard]] inline std::common_type_t<Q1, Q2, Q3> hypot(const Q1& x, const Q2& y, const Q3& z) noexcept
+[[nodiscard]] constexpr std::common_type_t<Q1, Q2, Q3> hypot(const Q1& x, const Q2& y, const Q3& z) noexcept
   requires requires { typename std::common_type_t<Q1, Q2, Q3>; } && requires(std::common_type_t<Q1, Q2, Q3> q) {
     requires requires { hypot(q.number(), q.number(), q.number()); } ||
                requires { std::hypot(q.number(), q.number(), q.number()); };
@@ -334,36 +552,58 @@ template<Quantity Q1, Quantity Q2, Quantity Q3>
   type xx = x;
   type yy = y;
   type zz = z;
-  using std::hypot;
-  return type(hypot(xx.number(), yy.number(), zz.number()));
+  return type(detail::hypot_number(xx.number(), yy.number(), zz.number()));
+}
+
+/**
+ * @brief Computes the Euclidean norm of any number of quantities,
+ *        without undue overflow or underflow at intermediate stages of the computation
+ *
+ * The common unit of the arguments and the factors to convert them to it are computed at compile time.
+ * The squares are summed directly unless the sum overflows or underflows, in which case the numbers are
+ * scaled by the largest of them.
+ *
+ * Available only for floating-point representation types as the sum of the squares of integral numbers
+ * overflows already for the numbers larger than the square root of the maximum value of the type.
+ */
+template<Quantity Q, Quantity... Qs>
+[[nodiscard]] constexpr std::common_type_t<Q, Qs...> norm(const Q& q, const Qs&... qs) noexcept
+  requires requires { typename std::common_type_t<Q, Qs...>; } &&
+           treat_as_floating_point<typename std::common_type_t<Q, Qs...>::rep> &&
+           requires(std::common_type_t<Q, Qs...> v) {
+             requires requires { sqrt(v.number()); } || requires { std::sqrt(v.number()); };
+           }
+{
+  using type = std::common_type_t<Q, Qs...>;
+  using rep = TYPENAME type::rep;
+  const std::array<rep, 1 + sizeof...(Qs)> numbers = {detail::scale_number<Q, type>(q.number()),
+                                                      detail::scale_number<Qs, type>(qs.number())...};
+  return type(detail::norm_number<rep>(numbers.size(), [&](std::size_t i) { return numbers[i]; }));
 }
 
 
 template<typename U, typename Rep>
   requires treat_as_floating_point<Rep>
-[[nodiscard]] inline dimensionless<one, Rep> sin(const angle<U, Rep>& q) noexcept
+[[nodiscard]] constexpr dimensionless<one, Rep> sin(const angle<U, Rep>& q) noexcept
   requires requires { sin(q.number()); } || requires { std::sin(q.number()); }
 {
-  using std::sin;
-  return sin(quantity_cast<radian>(q).number());
+  return detail::sin_number(quantity_cast<radian>(q).number());
 }
 
 template<typename U, typename Rep>
   requires treat_as_floating_point<Rep>
-[[nodiscard]] inline dimensionless<one, Rep> cos(const angle<U, Rep>& q) noexcept
+[[nodiscard]] constexpr dimensionless<one, Rep> cos(const angle<U, Rep>& q) noexcept
   requires requires { cos(q.number()); } || requires { std::cos(q.number()); }
 {
-  using std::cos;
-  return cos(quantity_cast<radian>(q).number());
+  return detail::cos_number(quantity_cast<radian>(q).number());
 }
 
 template<typename U, typename Rep>
   requires treat_as_floating_point<Rep>
-[[nodiscard]] inline dimensionless<one, Rep> tan(const angle<U, Rep>& q) noexcept
+[[nodiscard]] constexpr dimensionless<one, Rep> tan(const angle<U, Rep>& q) noexcept
   requires requires { tan(q.number()); } || requires { std::tan(q.number()); }
 {
-  using std::tan;
-  return tan(quantity_cast<radian>(q).number());
+  return detail::tan_number(quantity_cast<radian>(q).number());
 }
 
 
@@ -394,4 +634,262 @@ template<typename U, typename Rep>
   return angle<radian, Rep>(atan(quantity_cast<one>(q).number()));
 }
 
+namespace detail {
+
+// applies `f` directly to the numbers of the quantities
+// the loop works on raw pointers (without bounds checking) so the compiler is free to vectorize it
+template<typename In, std::size_t InExtent, typename Out, std::size_t OutExtent, typename F>
+constexpr void transform_numbers(std::span<In, InExtent> input, std::span<Out, OutExtent> output, F f)
+{
+  gsl_Expects(input.size() == output.size());
+  using rep = TYPENAME Out::rep;
+  const In* in = input.data();
+  Out* out = output.data();
+  const std::size_t size = input.size();
+  for (std::size_t i = 0; i < size; ++i) out[i] = Out(static_cast<rep>(f(in[i].number())));
+}
+
+template<typename In1, std::size_t InExtent1, typename In2, std::size_t InExtent2, typename Out,
+         std::size_t OutExtent, typename F>
+constexpr void transform_numbers(std::span<In1, InExtent1> input1, std::span<In2, InExtent2> input2,
+                                 std::span<Out, OutExtent> output, F f)
+{
+  gsl_Expects(input1.size() == output.size());
+  gsl_Expects(input2.size() == output.size());
+  using rep = TYPENAME Out::rep;
+  const In1* in1 = input1.data();
+  const In2* in2 = input2.data();
+  Out* out = output.data();
+  const std::size_t size = input1.size();
+  for (std::size_t i = 0; i < size; ++i) out[i] = Out(static_cast<rep>(f(in1[i].number(), in2[i].number())));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Computes the angle between the positive x axis and the point (x, y)
+ *
+ * If the units of the arguments differ only x is converted to the unit of y (the angle does not depend on the
+ * common unit of the coordinates).
+ *
+ * @param y Y coordinate of the point
+ * @param x X coordinate of the point of the quantity type that has a common type with the one of y
+ * @return angle<radian, Rep> The angle in [-pi, pi]
+ */
+template<Quantity Q1, Quantity Q2>
+  requires requires { typename std::common_type_t<Q1, Q2>; } &&
+           treat_as_floating_point<typename std::common_type_t<Q1, Q2>::rep>
+[[nodiscard]] inline angle<radian, typename std::common_type_t<Q1, Q2>::rep> atan2(const Q1& y, const Q2& x) noexcept
+  requires requires(typename std::common_type_t<Q1, Q2>::rep v) {
+    requires requires { atan2(v, v); } || requires { std::atan2(v, v); };
+  }
+{
+  using rep = TYPENAME std::common_type_t<Q1, Q2>::rep;
+  using y_type = quantity<typename Q1::dimension, typename Q1::unit, rep>;
+  using std::atan2;
+  return angle<radian, rep>(atan2(static_cast<rep>(y.number()), detail::scale_number<Q2, y_type>(x.number())));
+}
+
+/**
+ * @brief Computes the sine and the cosine of an angle
+ *
+ * Both values are computed with only one conversion of the angle and are equal to the results of `sin(q)` and
+ * `cos(q)`.
+ *
+ * @param q Angle being the base of the operation
+ * @return std::pair<dimensionless<one, Rep>, dimensionless<one, Rep>> The sine and the cosine of the angle
+ */
+template<typename U, typename Rep>
+  requires treat_as_floating_point<Rep>
+[[nodiscard]] constexpr std::pair<dimensionless<one, Rep>, dimensionless<one, Rep>> sincos(
+  const angle<U, Rep>& q) noexcept
+  requires requires {
+    sin(q.number());
+    cos(q.number());
+  } || requires {
+    std::sin(q.number());
+    std::cos(q.number());
+  }
+{
+  const auto [s, c] = detail::sincos_number(quantity_cast<radian>(q).number());
+  return {dimensionless<one, Rep>(s), dimensionless<one, Rep>(c)};
+}
+
+/**
+ * @brief Computes the square roots of a range of quantities
+ *
+ * The unit of the result is computed only once and the square roots are computed directly on the numbers of
+ * the quantities in a loop that the compiler can vectorize.
+ *
+ * @param input Quantities being the base of the operation
+ * @param output Quantities to store the results in (of the same size as `input`)
+ */
+template<typename Q, std::size_t InExtent, std::size_t OutExtent>
+  requires Quantity<std::remove_const_t<Q>> && requires(const Q& q) { ::units::sqrt(q); }
+constexpr void sqrt(std::span<Q, InExtent> input,
+                    std::span<decltype(::units::sqrt(std::declval<const Q&>())), OutExtent> output)
+{
+  detail::transform_numbers(input, output, [](const auto& v) { return detail::sqrt_number(v); });
+}
+
+/**
+ * @brief Computes the square roots of the sums of the squares of two ranges of quantities
+ *
+ * The common type of the arguments and the factors to convert them to it are computed only once and the
+ * `hypot` is computed directly on the numbers of the quantities in a loop that the compiler can vectorize.
+ *
+ * @param x, y Quantities being the base of the operation (of the same size)
+ * @param output Quantities to store the results in (of the same size as `x` and `y`)
+ */
+template<typename Q1, std::size_t Extent1, typename Q2, std::size_t Extent2, std::size_t OutExtent>
+  requires Quantity<std::remove_const_t<Q1>> && Quantity<std::remove_const_t<Q2>> &&
+           requires(const Q1& x, const Q2& y) { ::units::hypot(x, y); }
+constexpr void hypot(std::span<Q1, Extent1> x, std::span<Q2, Extent2> y,
+                     std::span<std::common_type_t<std::remove_const_t<Q1>, std::remove_const_t<Q2>>, OutExtent> output)
+{
+  using type = std::common_type_t<std::remove_const_t<Q1>, std::remove_const_t<Q2>>;
+  detail::transform_numbers(x, y, output, [](const auto& xx, const auto& yy) {
+    return detail::hypot_number(detail::scale_number<std::remove_const_t<Q1>, type>(xx),
+                                detail::scale_number<std::remove_const_t<Q2>, type>(yy));
+  });
+}
+
+/**
+ * @brief Computes the Euclidean norm of a range of quantities,
+ *        without undue overflow or underflow at intermediate stages of the computation
+ *
+ * The squares are summed directly in a loop that the compiler can vectorize unless the sum overflows or
+ * underflows, in which case the numbers are scaled by the largest of them. Available only for floating-point
+ * representation types.
+ *
+ * @param input Quantities being the base of the operation
+ */
+template<typename Q, std::size_t Extent>
+  requires Quantity<std::remove_const_t<Q>> && requires(const Q& q) { ::units::norm(q); }
+[[nodiscard]] constexpr std::remove_const_t<Q> norm(std::span<Q, Extent> input) noexcept
+{
+  using type = std::remove_const_t<Q>;
+  const Q* in = input.data();
+  return type(detail::norm_number<typename type::rep>(input.size(), [in](std::size_t i) { return in[i].number(); }));
+}
+
+/**
+ * @brief Computes the sines of a range of angles
+ *
+ * The conversion of the angles to radians is folded into the loop as a single multiplication by the
+ * compile-time factor (none for radians) and the loop works directly on the numbers of the quantities
+ * so the compiler can vectorize it.
+ *
+ * @param input Angles being the base of the operation
+ * @param output Dimensionless quantities to store the results in (of the same size as `input`)
+ */
+template<typename Q, std::size_t InExtent, std::size_t OutExtent>
+  requires Quantity<std::remove_const_t<Q>> && requires(const Q& q) { ::units::sin(q); }
+constexpr void sin(std::span<Q, InExtent> input,
+                   std::span<decltype(::units::sin(std::declval<const Q&>())), OutExtent> output)
+{
+  using rad = angle<radian, typename std::remove_const_t<Q>::rep>;
+  detail::transform_numbers(input, output, [](const auto& v) {
+    return detail::sin_number(detail::scale_number<std::remove_const_t<Q>, rad>(v));
+  });
+}
+
+/**
+ * @brief Computes the cosines of a range of angles
+ *
+ * The conversion of the angles to radians is folded into the loop as a single multiplication by the
+ * compile-time factor (none for radians) and the loop works directly on the numbers of the quantities
+ * so the compiler can vectorize it.
+ *
+ * @param input Angles being the base of the operation
+ * @param output Dimensionless quantities to store the results in (of the same size as `input`)
+ */
+template<typename Q, std::size_t InExtent, std::size_t OutExtent>
+  requires Quantity<std::remove_const_t<Q>> && requires(const Q& q) { ::units::cos(q); }
+constexpr void cos(std::span<Q, InExtent> input,
+                   std::span<decltype(::units::cos(std::declval<const Q&>())), OutExtent> output)
+{
+  using rad = angle<radian, typename std::remove_const_t<Q>::rep>;
+  detail::transform_numbers(input, output, [](const auto& v) {
+    return detail::cos_number(detail::scale_number<std::remove_const_t<Q>, rad>(v));
+  });
+}
+
+/**
+ * @brief Computes Euler's number raised to the powers given by a range of dimensionless quantities
+ *
+ * The conversions from and to the unit `one` are folded into the loop as multiplications by the
+ * compile-time factors (none for `one`) and the loop works directly on the numbers of the quantities
+ * so the compiler can vectorize it.
+ *
+ * @param input Dimensionless quantities being the base of the operation
+ * @param output Quantities to store the results in (of the same size as `input`)
+ */
+template<typename Q, std::size_t InExtent, std::size_t OutExtent>
+  requires Quantity<std::remove_const_t<Q>> && treat_as_floating_point<typename std::remove_const_t<Q>::rep> &&
+           requires(const Q& q) { ::units::exp(q); }
+constexpr void exp(std::span<Q, InExtent> input,
+                   std::span<decltype(::units::exp(std::declval<const Q&>())), OutExtent> output)
+{
+  using type = std::remove_const_t<Q>;
+  using one_type = dimensionless<one, typename type::rep>;
+  detail::transform_numbers(input, output, [](const auto& v) {
+    return detail::scale_number<one_type, type>(detail::exp_number(detail::scale_number<type, one_type>(v)));
+  });
+}
+
+/**
+ * @brief Computes the angles between the positive x axis and the points given by two ranges of coordinates
+ *
+ * The factor to convert x to the unit of y is computed only once (none if the units are the same) and the
+ * `atan2` is computed directly on the numbers of the quantities in a loop that the compiler can vectorize.
+ *
+ * @param y, x Coordinates of the points (of the same size)
+ * @param output Angles to store the results in (of the same size as `y` and `x`)
+ */
+template<typename Q1, std::size_t Extent1, typename Q2, std::size_t Extent2, std::size_t OutExtent>
+  requires Quantity<std::remove_const_t<Q1>> && Quantity<std::remove_const_t<Q2>> &&
+           requires(const Q1& y, const Q2& x) { ::units::atan2(y, x); }
+void atan2(std::span<Q1, Extent1> y, std::span<Q2, Extent2> x,
+           std::span<decltype(::units::atan2(std::declval<const Q1&>(), std::declval<const Q2&>())), OutExtent> output)
+{
+  using rep = TYPENAME decltype(::units::atan2(std::declval<const Q1&>(), std::declval<const Q2&>()))::rep;
+  using y_type = quantity<typename std::remove_const_t<Q1>::dimension, typename std::remove_const_t<Q1>::unit, rep>;
+  detail::transform_numbers(y, x, output, [](const auto& yy, const auto& xx) {
+    using std::atan2;
+    return atan2(static_cast<rep>(yy), detail::scale_number<std::remove_const_t<Q2>, y_type>(xx));
+  });
+}
+
+/**
+ * @brief Computes the sines and the cosines of a range of angles
+ *
+ * The conversion of the angles to radians is folded into the loop as a single multiplication by the
+ * compile-time factor (none for radians) and each angle is range reduced only once.
+ *
+ * @param input Angles being the base of the operation
+ * @param sin_output, cos_output Dimensionless quantities to store the sines and the cosines in (of the same size
+ *                               as `input`)
+ */
+template<typename Q, std::size_t InExtent, std::size_t SinExtent, std::size_t CosExtent>
+  requires Quantity<std::remove_const_t<Q>> && requires(const Q& q) { ::units::sincos(q); }
+constexpr void sincos(std::span<Q, InExtent> input,
+                      std::span<decltype(::units::sin(std::declval<const Q&>())), SinExtent> sin_output,
+                      std::span<decltype(::units::cos(std::declval<const Q&>())), CosExtent> cos_output)
+{
+  gsl_Expects(input.size() == sin_output.size());
+  gsl_Expects(input.size() == cos_output.size());
+  using rad = angle<radian, typename std::remove_const_t<Q>::rep>;
+  using out_type = TYPENAME decltype(sin_output)::value_type;
+  const Q* in = input.data();
+  out_type* sin_out = sin_output.data();
+  out_type* cos_out = cos_output.data();
+  const std::size_t size = input.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto [s, c] = detail::sincos_number(detail::scale_number<std::remove_const_t<Q>, rad>(in[i].number()));
+    sin_out[i] = out_type(s);
+    cos_out[i] = out_type(c);
+  }
+}
+
 }  // namespace units
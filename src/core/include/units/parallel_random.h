@@ -0,0 +1,106 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/random.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace units {
+
+namespace detail {
+
+// the number of quantities generated from one jump-ahead of the engine
+inline constexpr std::size_t parallel_generate_block_size = 4096;
+
+// the numbers of the engine reserved for a block (2^20 per quantity, way more than any distribution uses)
+inline constexpr std::uint64_t parallel_generate_block_stride = std::uint64_t{1} << 32;
+
+template<typename ExecutionPolicy>
+inline constexpr bool is_unsequenced_policy =
+  std::same_as<ExecutionPolicy, std::execution::parallel_unsequenced_policy> ||
+  std::same_as<ExecutionPolicy, std::execution::unsequenced_policy>;
+
+}  // namespace detail
+
+/**
+ * @brief Fills the range with the quantities of the distribution in parallel
+ *
+ * The range is divided into fixed blocks of quantities, and the block `i` is filled by a reset copy of the distribution
+ * (one per worker) and a copy of the engine jumped ahead to the `i`-th reserved part of its stream. That is why the
+ * results depend only on the state of the engine and not on the execution policy or the number of threads, and are
+ * the same on every run. After the call the engine is moved past all the reserved parts, so the next call continues
+ * with new numbers.
+ *
+ * The unsequenced policies (`std::execution::unseq` and `std::execution::par_unseq`) do not allow the allocations
+ * done when copying the distributions that store their weights or intervals in a `std::vector` (e.g.
+ * `discrete_distribution`), so only the distributions with non-throwing copies can be used with them.
+ *
+ * @note With libstdc++ the parallel algorithms of `<execution>` run on TBB when its headers are installed, so the
+ *       targets using this function have to link `TBB::tbb` then (e.g. after `find_package(TBB)` in CMake).
+ *
+ * @param policy the execution policy of the blocks (e.g. `std::execution::par`)
+ * @param d the distribution
+ * @param g the engine
+ * @param out the range to fill
+ */
+template<typename ExecutionPolicy, typename Distribution, std::size_t Rounds, Quantity Q>
+  requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>> &&
+           (!detail::is_unsequenced_policy<std::remove_cvref_t<ExecutionPolicy>> ||
+            std::is_nothrow_copy_constructible_v<Distribution>)
+void parallel_generate(ExecutionPolicy&& policy, const Distribution& d, philox_engine<Rounds>& g, std::span<Q> out)
+{
+  using detail::parallel_generate_block_size;
+  using detail::parallel_generate_block_stride;
+
+  const std::size_t blocks = (out.size() + parallel_generate_block_size - 1) / parallel_generate_block_size;
+  const std::size_t workers = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, std::max(blocks, std::size_t{1}));
+
+  // the worker `w` fills the blocks [w * blocks / workers, (w + 1) * blocks / workers)
+  std::vector<std::size_t> chunks(workers);
+  std::iota(chunks.begin(), chunks.end(), std::size_t{0});
+  std::for_each(std::forward<ExecutionPolicy>(policy), chunks.begin(), chunks.end(), [&](std::size_t w) {
+    Distribution local = d;
+    for (std::size_t i = w * blocks / workers; i < (w + 1) * blocks / workers; ++i) {
+      // the cached numbers of the previous block would make the results depend on the number of workers
+      if constexpr (requires { local.reset(); }) local.reset();
+      philox_engine<Rounds> engine = g;
+      engine.discard(i * parallel_generate_block_stride);
+      const std::size_t offset = i * parallel_generate_block_size;
+      local.generate(engine, out.subspan(offset, std::min(parallel_generate_block_size, out.size() - offset)));
+      gsl_ExpectsAudit(engine.position() - g.position() <= (i + 1) * parallel_generate_block_stride);  // out of numbers
+    }
+  });
+  g.discard(blocks * parallel_generate_block_stride);
+}
+
+}  // namespace units
@@ -24,10 +24,17 @@
 
 #include <units/bits/dimension_op.h>
 #include <units/bits/external/type_traits.h>
+#include <units/bits/int128.h>
 #include <units/concepts.h>
 #include <units/customization_points.h>
 #include <units/magnitude.h>
 #include <units/reference.h>
+#include <gsl/gsl-lite.hpp>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
 
 UNITS_DIAGNOSTIC_PUSH
 // warning C4244: 'argument': conversion from 'intmax_t' to 'T', possible loss of data with T=int
@@ -47,6 +54,49 @@ class quantity_kind;
 template<PointKind PK, UnitOf<typename PK::dimension> U, Representation Rep>
 class quantity_point_kind;
 
+/**
+ * @brief Policies of handling the numbers that do not fit in the target integral representation type of
+ *        `quantity_cast`
+ *
+ * - `checked` throws `std::overflow_error`,
+ * - `saturating` clamps the number to `quantity_values<Rep>::min()` or `quantity_values<Rep>::max()`,
+ * - `wrapping` reduces the number modulo 2^N (where N is the width of the representation type).
+ */
+namespace overflow {
+
+struct checked_t {};
+struct saturating_t {};
+struct wrapping_t {};
+
+inline constexpr checked_t checked{};
+inline constexpr saturating_t saturating{};
+inline constexpr wrapping_t wrapping{};
+
+}  // namespace overflow
+
+/**
+ * @brief Rounding modes of the integral `quantity_cast`
+ *
+ * The exact quotient of the conversion is rounded toward zero (like the built-in integral division does), toward
+ * negative infinity (`floor`), toward positive infinity (`ceil`), or to the nearest integer with halfway cases
+ * rounded to the even one (`half_to_even`) or away from zero (`half_away_from_zero`).
+ */
+namespace rounding {
+
+struct toward_zero_t {};
+struct floor_t {};
+struct ceil_t {};
+struct half_to_even_t {};
+struct half_away_from_zero_t {};
+
+inline constexpr toward_zero_t toward_zero{};
+inline constexpr floor_t floor{};
+inline constexpr ceil_t ceil{};
+inline constexpr half_to_even_t half_to_even{};
+inline constexpr half_away_from_zero_t half_away_from_zero{};
+
+}  // namespace rounding
+
 namespace detail {
 
 template<Quantity Q>
@@ -63,6 +113,11 @@ inline constexpr Magnitude auto cast_magnitude = [] {
   }
 }();
 
+/*
+ * The types used by `quantity_cast` to scale the numbers of the representation `From` to the representation `To`.
+ * A specialization may instead provide the static member function template `scale<Magnitude auto M>(const From&)`
+ * returning the number multiplied by `M` (e.g. `units/fixed_point.h`).
+ */
 template<typename From, typename To>
 struct cast_traits;
 
@@ -93,6 +148,124 @@ struct cast_traits<From, To> {
   using rep_type = std::common_type_t<From, To>;
 };
 
+template<typename T>
+concept overflow_policy_ =
+  is_same_v<T, overflow::checked_t> || is_same_v<T, overflow::saturating_t> || is_same_v<T, overflow::wrapping_t>;
+
+template<typename T>
+concept rounding_mode_ =
+  is_same_v<T, rounding::toward_zero_t> || is_same_v<T, rounding::floor_t> || is_same_v<T, rounding::ceil_t> ||
+  is_same_v<T, rounding::half_to_even_t> || is_same_v<T, rounding::half_away_from_zero_t>;
+
+template<typename T>
+concept cast_policy_ = overflow_policy_<T> || rounding_mode_<T>;
+
+// `offset + n / D` (for a positive `D` and `offset` of the same sign as `n`) rounded as `Mode` dictates with one
+// division and a branch-free fixup of its quotient
+template<rounding_mode_ Mode, auto D, std::integral T>
+[[nodiscard]] constexpr T divide_rounded(T n, T offset = 0)
+{
+  constexpr T d = D;
+  const T q = offset + n / d;
+  const T r = n % d;
+  const bool negative = std::cmp_less(r, 0);
+  const bool positive = std::cmp_greater(r, 0);
+  if constexpr (is_same_v<Mode, rounding::toward_zero_t>) {
+    return q;
+  } else if constexpr (is_same_v<Mode, rounding::floor_t>) {
+    return q - static_cast<T>(negative);
+  } else if constexpr (is_same_v<Mode, rounding::ceil_t>) {
+    return q + static_cast<T>(positive);
+  } else {
+    const T abs_r = negative ? static_cast<T>(0 - r) : r;
+    const T rest = d - abs_r;
+    bool away = abs_r > rest;
+    if constexpr (is_same_v<Mode, rounding::half_to_even_t>)
+      away |= abs_r == rest && (q & 1) != 0;
+    else
+      away |= abs_r == rest;
+    return q + static_cast<T>(positive && away) - static_cast<T>(negative && away);
+  }
+}
+
+#if UNITS_COMP_MSVC
+
+template<std::integral T>
+[[nodiscard]] constexpr std::uint64_t unsigned_abs(T v)
+{
+  const auto u = static_cast<std::uint64_t>(v);
+  return std::cmp_less(v, 0) ? 0 - u : u;
+}
+
+// stores the number of the given sign and 128-bit magnitude modulo 2^N and returns `true` if it does not fit in `T`
+template<std::integral T>
+[[nodiscard]] constexpr bool store_overflow(bool negative, uint64_pair m, T* res)
+{
+  *res = static_cast<T>(negative ? 0 - m.lo : m.lo);
+  if (m.hi != 0) return true;
+  return negative ? m.lo > unsigned_abs(std::numeric_limits<T>::min())
+                  : m.lo > static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+}
+
+#endif
+
+// the equivalents of `__builtin_mul_overflow` and `__builtin_add_overflow` (the exact result of mixed-type operands
+// is stored modulo 2^N and `true` is returned if it does not fit in `T`)
+template<std::integral T, std::integral A, std::integral B>
+[[nodiscard]] constexpr bool mul_overflow(A a, B b, T* res)
+{
+#if UNITS_COMP_MSVC
+  return store_overflow(std::cmp_less(a, 0) != std::cmp_less(b, 0), umul128(unsigned_abs(a), unsigned_abs(b)), res);
+#else
+  return __builtin_mul_overflow(a, b, res);
+#endif
+}
+
+template<std::integral T, std::integral A, std::integral B>
+[[nodiscard]] constexpr bool add_overflow(A a, B b, T* res)
+{
+#if UNITS_COMP_MSVC
+  const bool a_neg = std::cmp_less(a, 0);
+  const bool b_neg = std::cmp_less(b, 0);
+  const std::uint64_t ma = unsigned_abs(a);
+  const std::uint64_t mb = unsigned_abs(b);
+  if (a_neg == b_neg) return store_overflow(a_neg, {ma + mb < ma ? 1u : 0u, ma + mb}, res);
+  return ma >= mb ? store_overflow(a_neg, {0, ma - mb}, res) : store_overflow(b_neg, {0, mb - ma}, res);
+#else
+  return __builtin_add_overflow(a, b, res);
+#endif
+}
+
+// stores `v * M` truncated toward zero and modulo 2^N in `res` and returns `true` if the exact result does not fit
+// in `To`; unlike `v * num / den` the intermediate results overflow only if the final one does
+template<std::integral To, Magnitude auto M, std::integral Rep>
+  requires(is_rational(M))
+[[nodiscard]] constexpr bool scale_overflow(Rep v, To* res)
+{
+  using wide = std::common_type_t<Rep, widen_t<Rep>>;
+  constexpr wide num = get_value<wide>(numerator(M));
+  constexpr wide den = get_value<wide>(denominator(M));
+  if constexpr (den == 1) {
+    return mul_overflow(v, num, res);
+  } else {
+    // v * num / den == v / den * num + v % den * num / den
+    static_assert(den - 1 <= std::numeric_limits<wide>::max() / num, "the magnitude of the conversion is too large");
+    const wide q = static_cast<wide>(v) / den;
+    const wide r = static_cast<wide>(v) % den;
+    To t{};
+    const bool overflowed = mul_overflow(q, num, &t);
+    return add_overflow(t, r * num / den, res) || overflowed;
+  }
+}
+
+// `scale_overflow` is monotonic so only the limits of `Rep` have to be checked
+template<typename To, Magnitude auto M, typename Rep>
+inline constexpr bool may_overflow = [] {
+  To res{};
+  return scale_overflow<To, M>(std::numeric_limits<Rep>::lowest(), &res) ||
+         scale_overflow<To, M>(std::numeric_limits<Rep>::max(), &res);
+}();
+
 }  // namespace detail
 
 /**
@@ -112,16 +285,30 @@ template<Quantity To, typename D, typename U, scalable_with_<typename To::rep> R
 [[nodiscard]] constexpr auto quantity_cast(const quantity<D, U, Rep>& q)
 {
   using traits = detail::cast_traits<Rep, typename To::rep>;
-  using ratio_type = TYPENAME traits::ratio_type;
-  using rep_type = TYPENAME traits::rep_type;
 
   constexpr Magnitude auto c_mag = detail::cast_magnitude<quantity<D, U, Rep>, To>;
-  constexpr Magnitude auto num = numerator(c_mag);
-  constexpr Magnitude auto den = denominator(c_mag);
-  constexpr Magnitude auto irr = c_mag * (den / num);
+  if constexpr (requires { traits::template scale<c_mag>(q.number()); }) {
+    return To(static_cast<TYPENAME To::rep>(traits::template scale<c_mag>(q.number())));
+  } else {
+    using ratio_type = TYPENAME traits::ratio_type;
+    using rep_type = TYPENAME traits::rep_type;
 
-  constexpr auto val = [](Magnitude auto m) { return get_value<ratio_type>(m); };
-  return To(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.number()) * val(num) / val(den) * val(irr)));
+    constexpr Magnitude auto num = numerator(c_mag);
+    constexpr Magnitude auto den = denominator(c_mag);
+    constexpr Magnitude auto irr = c_mag * (den / num);
+
+    constexpr auto val = [](Magnitude auto m) { return get_value<ratio_type>(m); };
+    if constexpr (std::is_integral_v<ratio_type>) {
+      // the factors are constant expressions so the compiler replaces the division with a multiplication by
+      // a precomputed reciprocal and a shift (Granlund-Montgomery) even in unoptimized builds
+      constexpr ratio_type num_value = val(num);
+      constexpr ratio_type den_value = val(den);
+      constexpr ratio_type irr_value = val(irr);
+      return To(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.number()) * num_value / den_value * irr_value));
+    } else {
+      return To(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.number()) * val(num) / val(den) * val(irr)));
+    }
+  }
 }
 
 /**
@@ -204,6 +391,131 @@ template<Representation ToRep, typename D, typename U, scalable_with_<ToRep> Rep
   return quantity_cast<quantity<D, U, ToRep>>(q);
 }
 
+namespace detail {
+
+template<typename CastSpec, typename Q>
+using quantity_cast_result = decltype(quantity_cast<CastSpec>(std::declval<const Q&>()));
+
+}  // namespace detail
+
+/**
+ * @brief Explicit cast of a quantity of an integral representation type with a policy of handling an overflow
+ *
+ * The number is scaled exactly (truncating toward zero) even if its intermediate product with the numerator of the
+ * conversion factor does not fit in `std::intmax_t`. If the result does not fit in the target representation type
+ * it is handled as the `overflow::checked`, `overflow::saturating`, or `overflow::wrapping` policy dictates.
+ * No checks are done at runtime if the result of the conversion fits for every number of the source representation
+ * type. For example:
+ *
+ * auto q1 = units::quantity_cast<units::isq::si::nanosecond>(d, units::overflow::saturating);
+ *
+ * @tparam CastSpec a target quantity type to cast to or anything that works for quantity_cast
+ */
+template<typename CastSpec, typename D, typename U, std::integral Rep, detail::overflow_policy_ Policy>
+  requires std::integral<typename detail::quantity_cast_result<CastSpec, quantity<D, U, Rep>>::rep> &&
+           (is_rational(detail::cast_magnitude<quantity<D, U, Rep>,
+                                               detail::quantity_cast_result<CastSpec, quantity<D, U, Rep>>>))
+[[nodiscard]] constexpr auto quantity_cast(const quantity<D, U, Rep>& q, Policy)
+{
+  using To = detail::quantity_cast_result<CastSpec, quantity<D, U, Rep>>;
+  using rep = TYPENAME To::rep;
+  constexpr Magnitude auto c_mag = detail::cast_magnitude<quantity<D, U, Rep>, To>;
+
+  rep res{};
+  [[maybe_unused]] const bool overflowed = detail::scale_overflow<rep, c_mag>(q.number(), &res);
+  if constexpr (detail::may_overflow<rep, c_mag, Rep> && !is_same_v<Policy, overflow::wrapping_t>) {
+    if (overflowed) {
+      if constexpr (is_same_v<Policy, overflow::checked_t>)
+        throw std::overflow_error("quantity_cast: the number does not fit in the representation type");
+      else
+        res = std::cmp_less(q.number(), 0) ? quantity_values<rep>::min() : quantity_values<rep>::max();
+    }
+  }
+  return To(res);
+}
+
+/**
+ * @brief Explicit cast of a quantity of an integral representation type with a rounding mode
+ *
+ * The exact quotient of the conversion is rounded as the `rounding::toward_zero`, `rounding::floor`,
+ * `rounding::ceil`, `rounding::half_to_even`, or `rounding::half_away_from_zero` mode dictates. The number is
+ * adjusted without branching and, like for the overflow policies, the intermediate results do not overflow if
+ * the final one does not. The quotient is computed with one division if the product of any number of `Rep` and
+ * the numerator of the conversion factor fits in the integer type of the computation (e.g. for all the conversions
+ * to larger units), and with two divisions (of the number and of its remainder) otherwise. For example:
+ *
+ * auto q1 = units::quantity_cast<units::isq::si::metre>(1500_q_mm, units::rounding::half_to_even);
+ *
+ * @tparam CastSpec a target quantity type to cast to or anything that works for quantity_cast
+ */
+template<typename CastSpec, typename D, typename U, std::integral Rep, detail::rounding_mode_ Mode>
+  requires std::integral<typename detail::quantity_cast_result<CastSpec, quantity<D, U, Rep>>::rep> &&
+           (is_rational(detail::cast_magnitude<quantity<D, U, Rep>,
+                                               detail::quantity_cast_result<CastSpec, quantity<D, U, Rep>>>))
+[[nodiscard]] constexpr auto quantity_cast(const quantity<D, U, Rep>& q, Mode)
+{
+  using To = detail::quantity_cast_result<CastSpec, quantity<D, U, Rep>>;
+  using rep = TYPENAME To::rep;
+  using ratio_type = TYPENAME detail::cast_traits<Rep, rep>::ratio_type;
+  constexpr Magnitude auto c_mag = detail::cast_magnitude<quantity<D, U, Rep>, To>;
+
+  constexpr ratio_type num = get_value<ratio_type>(numerator(c_mag));
+  constexpr ratio_type den = get_value<ratio_type>(denominator(c_mag));
+  static_assert(den - 1 <= std::numeric_limits<ratio_type>::max() / num, "the magnitude of the conversion is too large");
+  const auto v = static_cast<ratio_type>(q.number());
+  // `v * num` does not overflow for any value of `Rep` (always the case for `num == 1`), so one division suffices
+  constexpr bool product_fits =
+    std::cmp_less_equal(std::numeric_limits<Rep>::max(), std::numeric_limits<ratio_type>::max() / num) &&
+    std::cmp_greater_equal(std::numeric_limits<Rep>::min(), std::numeric_limits<ratio_type>::min() / num);
+  if constexpr (product_fits)
+    return To(static_cast<rep>(detail::divide_rounded<Mode, den>(v * num)));
+  else
+    // v * num / den == v / den * num + v % den * num / den where only the second term has to be rounded (so that
+    // the intermediate results do not overflow for the large numbers at the cost of the second division)
+    return To(static_cast<rep>(detail::divide_rounded<Mode, den>(v % den * num, v / den * num)));
+}
+
+/**
+ * @brief Explicit cast of a quantity of an integral representation type with an overflow policy or a rounding mode
+ *
+ * This cast gets both the target dimension and unit to cast to. For example:
+ *
+ * auto q1 = units::quantity_cast<units::isq::si::dim_time, units::isq::si::nanosecond>(d, units::overflow::checked);
+ *
+ * @tparam ToD a dimension type to use for a target quantity
+ * @tparam ToU a unit type to use for a target quantity
+ */
+template<Dimension ToD, Unit ToU, typename D, typename U, typename Rep, detail::cast_policy_ Policy>
+  requires equivalent<ToD, D> && UnitOf<ToU, ToD>
+[[nodiscard]] constexpr auto quantity_cast(const quantity<D, U, Rep>& q, Policy p)
+  -> decltype(quantity_cast<quantity<ToD, ToU, Rep>>(q, p))
+{
+  return quantity_cast<quantity<ToD, ToU, Rep>>(q, p);
+}
+
+/**
+ * @brief Explicit cast of a range of quantities
+ *
+ * Casts every quantity of `input` to the type of the quantities of `output` (with an optional overflow policy
+ * or rounding mode). The conversion factor is computed only once for the whole range. For example:
+ *
+ * units::quantity_cast(std::span(millimetres), std::span(metres), units::rounding::half_to_even);
+ *
+ * @param input Quantities to cast
+ * @param output Quantities to store the results in (of the same size as `input`)
+ */
+template<typename Q, std::size_t InExtent, Quantity To, std::size_t OutExtent, detail::cast_policy_... Policy>
+  requires Quantity<std::remove_const_t<Q>> && (sizeof...(Policy) <= 1) &&
+           requires(const Q& q, Policy... p) { quantity_cast<To>(q, p...); }
+constexpr void quantity_cast(std::span<Q, InExtent> input, std::span<To, OutExtent> output, Policy... p)
+{
+  gsl_Expects(input.size() == output.size());
+  const Q* in = input.data();
+  To* out = output.data();
+  const std::size_t size = input.size();
+  for (std::size_t i = 0; i < size; ++i) out[i] = quantity_cast<To>(in[i], p...);
+}
+
 /**
  * @brief Explicit cast of a quantity point
  *
@@ -22,68 +22,403 @@
 
 #pragma once
 
+#include <units/bits/constexpr_math.h>
 #include <units/concepts.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <random>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace units {
 
 namespace detail {
-template<Quantity Q, typename InputIt>
-static std::vector<typename Q::rep> i_qty_to_rep(InputIt first, InputIt last)
+
+// the numbers of the quantities (views, so that the `std::` distributions are constructed without temporary copies)
+template<typename InputIt>
+[[nodiscard]] auto i_qty_to_rep(InputIt first, InputIt last)
 {
-  std::vector<typename Q::rep> intervals_rep;
-  intervals_rep.reserve(static_cast<size_t>(std::distance(first, last)));
-  for (auto itr = first; itr != last; ++itr) {
-    intervals_rep.push_back(itr->number());
-  }
-  return intervals_rep;
+  return std::ranges::subrange(first, last) | std::views::transform([](const auto& qty) { return qty.number(); });
 }
 
 template<Quantity Q>
-static std::vector<typename Q::rep> bl_qty_to_rep(std::initializer_list<Q>& bl)
+[[nodiscard]] auto bl_qty_to_rep(std::initializer_list<Q>& bl)
 {
-  std::vector<typename Q::rep> bl_rep;
-  bl_rep.reserve(bl.size());
-  for (const Q& qty : bl) {
-    bl_rep.push_back(qty.number());
-  }
-  return bl_rep;
+  return i_qty_to_rep(bl.begin(), bl.end());
 }
 
 template<Quantity Q, typename UnaryOperation>
-inline static std::vector<typename Q::rep> fw_bl_pwc(std::initializer_list<Q>& bl, UnaryOperation fw)
+[[nodiscard]] auto fw_bl_pwc(std::initializer_list<Q>& bl, UnaryOperation fw)
 {
   using rep = TYPENAME Q::rep;
-  std::vector<rep> w_bl;
-  w_bl.reserve(bl.size());
-  for (const Q& qty : bl) {
-    w_bl.push_back(fw(qty));
-  }
-  std::vector<rep> weights;
-  weights.reserve(bl.size());
-  for (size_t i = 0; i < bl.size() - 1; ++i) {
-    weights.push_back(w_bl[i] + w_bl[i + 1]);
-  }
-  weights.push_back(0);
-  return weights;
+  return std::views::iota(std::size_t{0}, bl.size() < 2 ? std::size_t{0} : bl.size() - 1) |
+         std::views::transform([&bl, fw](std::size_t i) -> rep { return fw(bl.begin()[i]) + fw(bl.begin()[i + 1]); });
 }
 
 template<Quantity Q, typename UnaryOperation>
-static std::vector<typename Q::rep> fw_bl_pwl(std::initializer_list<Q>& bl, UnaryOperation fw)
+[[nodiscard]] auto fw_bl_pwl(std::initializer_list<Q>& bl, UnaryOperation fw)
+{
+  using rep = TYPENAME Q::rep;
+  return bl | std::views::transform([fw](const Q& qty) -> rep { return fw(qty); });
+}
+
+// 64 uniformly distributed random bits (one call of the full-range 64-bit engines or two of the 32-bit ones)
+template<typename Generator>
+[[nodiscard]] std::uint64_t random_bits(Generator& g)
+{
+  constexpr auto range = static_cast<std::uint64_t>(Generator::max() - Generator::min());
+  if constexpr (range == std::numeric_limits<std::uint64_t>::max()) {
+    return static_cast<std::uint64_t>(g() - Generator::min());
+  } else if constexpr (range == std::numeric_limits<std::uint32_t>::max()) {
+    const auto high = static_cast<std::uint64_t>(g() - Generator::min());
+    return (high << 32) | static_cast<std::uint64_t>(g() - Generator::min());
+  } else {
+    return std::uniform_int_distribution<std::uint64_t>()(g);
+  }
+}
+
+// a uniformly distributed number in [0, 1) made of the leading random bits (without the divisions of
+// `std::generate_canonical`)
+template<std::floating_point T>
+[[nodiscard]] constexpr T canonical(std::uint64_t bits) noexcept
+{
+  constexpr int digits = std::numeric_limits<T>::digits < 64 ? std::numeric_limits<T>::digits : 64;
+  constexpr T scale = constexpr_ldexp(T(1), -digits);
+  return static_cast<T>(bits >> (64 - digits)) * scale;
+}
+
+// generates the quantities one by one with the `operator()` of the distribution
+template<typename Distribution, typename Generator, typename OutputIt>
+OutputIt generate_each(Distribution& d, Generator& g, OutputIt first, std::size_t n)
+{
+  for (; n > 0; --n) *first++ = d(g);
+  return first;
+}
+
+/* the bulk generation of quantities for the distribution `Derived`; `generate()` forwards to `generate_n()` of
+ `Derived`, which calls its `operator()` for each quantity unless `Derived` hides it with a faster one
+ */
+template<typename Derived, typename Q>
+struct bulk_generation {
+  template<typename Generator>
+  void generate(Generator& g, std::span<Q> out)
+  {
+    static_cast<Derived&>(*this).generate_n(g, out.begin(), out.size());
+  }
+
+  template<typename Generator>
+    requires std::invocable<const Derived&, Generator&>
+  void generate(Generator& g, std::span<Q> out) const
+  {
+    static_cast<const Derived&>(*this).generate_n(g, out.begin(), out.size());
+  }
+
+  template<typename Generator, std::output_iterator<Q> OutputIt>
+  OutputIt generate_n(Generator& g, OutputIt first, std::size_t n)
+  {
+    return generate_each(static_cast<Derived&>(*this), g, first, n);
+  }
+
+  template<typename Generator, std::output_iterator<Q> OutputIt>
+    requires std::invocable<const Derived&, Generator&>
+  OutputIt generate_n(Generator& g, OutputIt first, std::size_t n) const
+  {
+    return generate_each(static_cast<const Derived&>(*this), g, first, n);
+  }
+};
+
+/* the layers of the Ziggurat method (G. Marsaglia, W. W. Tsang, "The Ziggurat Method for Generating Random Variables")
+ 256 layers of the same area `v` under a decreasing density f where `x[i]` is the right edge of the layer `i` and
+ `f[i] = f(x[i])`; the base layer 0 (a rectangle and the tail beyond `r`) is represented with `x[0] = v / f(r)`
+ */
+struct ziggurat {
+  static constexpr std::size_t layers = 256;
+  double r;
+  std::array<double, layers + 1> x{};
+  std::array<double, layers + 1> f{};
+};
+
+// the tables of the density f with the inverse f_inv (computed at compile time)
+template<typename F, typename FInv>
+[[nodiscard]] constexpr ziggurat make_ziggurat(long double r, long double v, F f, FInv f_inv)
 {
-  std::vector<typename Q::rep> weights;
-  weights.reserve(bl.size());
-  for (const Q& qty : bl) {
-    weights.push_back(fw(qty));
+  ziggurat res{.r = static_cast<double>(r)};
+  long double x = r;
+  res.x[0] = static_cast<double>(v / f(x));
+  res.x[1] = static_cast<double>(r);
+  for (std::size_t i = 1; i < ziggurat::layers - 1; ++i) {
+    x = f_inv(v / x + f(x));
+    res.x[i + 1] = static_cast<double>(x);
   }
-  return weights;
+  res.x[ziggurat::layers] = 0;
+  for (std::size_t i = 0; i <= ziggurat::layers; ++i) res.f[i] = static_cast<double>(f(res.x[i]));
+  return res;
+}
+
+// variable templates so that the tables are computed only in the translation units that use them
+template<std::same_as<double> T>
+inline constexpr ziggurat normal_ziggurat = make_ziggurat(
+  3.6541528853610088L, 4.928673233974658e-3L, [](long double x) { return constexpr_exp(-x * x / 2); },
+  [](long double y) { return constexpr_sqrt(-2 * constexpr_log(y)); });
+
+template<std::same_as<double> T>
+inline constexpr ziggurat exponential_ziggurat = make_ziggurat(
+  7.69711747013104972L, 3.949659822581556e-3L, [](long double x) { return constexpr_exp(-x); },
+  [](long double y) { return -constexpr_log(y); });
+
+// a uniformly distributed number in (0, 1)
+template<typename Generator>
+[[nodiscard]] double open_canonical(Generator& g)
+{
+  return (static_cast<double>(random_bits(g) >> 11) + 0.5) * 0x1p-53;
 }
+
+// a sample of the standard normal distribution (one random number and no transcendental functions for ~99% of them)
+template<typename Generator>
+[[nodiscard]] double standard_normal(Generator& g)
+{
+  constexpr const ziggurat& zig = normal_ziggurat<double>;
+  while (true) {
+    const std::uint64_t bits = random_bits(g);
+    // the lowest 8 bits select the layer and the highest 53 ones make a number in [-1, 1)
+    const auto i = static_cast<std::size_t>(bits & 0xff);
+    const double u = static_cast<double>(static_cast<std::int64_t>(bits) >> 11) * 0x1p-52;
+    const double x = u * zig.x[i];
+    if (std::abs(x) < zig.x[i + 1]) return x;
+    if (i == 0) {
+      // the tail beyond r
+      double tx = 0;
+      double ty = 0;
+      do {
+        tx = std::log(open_canonical(g)) / zig.r;
+        ty = std::log(open_canonical(g));
+      } while (-2 * ty < tx * tx);
+      return u < 0 ? tx - zig.r : zig.r - tx;
+    }
+    if (zig.f[i + 1] + (zig.f[i] - zig.f[i + 1]) * canonical<double>(random_bits(g)) < std::exp(-x * x / 2)) return x;
+  }
+}
+
+// a sample of the standard exponential distribution (one random number and no transcendental functions for ~99% of
+// them)
+template<typename Generator>
+[[nodiscard]] double standard_exponential(Generator& g)
+{
+  constexpr const ziggurat& zig = exponential_ziggurat<double>;
+  while (true) {
+    const std::uint64_t bits = random_bits(g);
+    // the lowest 8 bits select the layer and the highest 53 ones make a number in [0, 1)
+    const auto i = static_cast<std::size_t>(bits & 0xff);
+    const double x = canonical<double>(bits) * zig.x[i];
+    if (x < zig.x[i + 1]) return x;
+    // the tail beyond r is the same exponential distribution shifted by r
+    if (i == 0) return zig.r - std::log(open_canonical(g));
+    if (zig.f[i + 1] + (zig.f[i] - zig.f[i + 1]) * canonical<double>(random_bits(g)) < std::exp(-x)) return x;
+  }
+}
+
+// stores the boundaries of the intervals of a fixed piecewise distribution (false if there are less than 2 of them)
+template<Quantity Q, std::size_t N, typename InputIt>
+bool set_intervals(std::array<Q, N>& intervals, std::size_t& n, InputIt first, InputIt last)
+{
+  std::size_t size = 0;
+  for (; first != last; ++first) {
+    gsl_Expects(size < N);
+    intervals[size++] = *first;
+  }
+  if (size < 2) return false;
+  n = size - 1;
+  return true;
+}
+
+// stores the boundaries of `nw` intervals of the same width and returns the width
+template<Quantity Q, std::size_t N>
+typename Q::rep set_intervals(std::array<Q, N>& intervals, std::size_t& n, std::size_t nw, const Q& xmin, const Q& xmax)
+{
+  using rep = TYPENAME Q::rep;
+  n = nw == 0 ? 1 : nw;
+  gsl_Expects(n < N);
+  const rep delta = (xmax - xmin).number() / static_cast<rep>(n);
+  for (std::size_t i = 0; i <= n; ++i) intervals[i] = Q(xmin.number() + static_cast<rep>(i) * delta);
+  return delta;
+}
+
+// the interval of a fixed piecewise distribution selected with a binary search over the cumulative probabilities,
+// and the remaining part of the probability inside of it
+template<typename T, std::size_t N, typename Generator>
+std::pair<std::size_t, T> select_interval(const std::array<T, N>& cumulative, std::size_t n, Generator& g)
+{
+  const T u = canonical<T>(random_bits(g)) * cumulative[n - 1];
+  const auto it = std::upper_bound(cumulative.begin(), cumulative.begin() + static_cast<std::ptrdiff_t>(n - 1), u);
+  const auto i = static_cast<std::size_t>(it - cumulative.begin());
+  return {i, i > 0 ? u - cumulative[i - 1] : u};
+}
+
+/* Walker's alias table built with the method of M. D. Vose ("A Linear Algorithm For Generating Random Numbers With
+ a Given Distribution") to select one of the indices with the given probabilities with one random number, one lookup,
+ and no search; the lowest 32 bits of the random number select a column, and the highest 32 ones decide between its
+ own index and its alias
+ */
+class alias_table {
+public:
+  alias_table() = default;
+
+  explicit alias_table(const std::vector<double>& probabilities) : columns_(probabilities.size())
+  {
+    const std::size_t n = probabilities.size();
+    gsl_Expects(n > 0 && n <= std::numeric_limits<std::uint32_t>::max());
+
+    std::vector<double> scaled(n);
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    for (std::uint32_t i = 0; i < n; ++i) {
+      scaled[i] = probabilities[i] * static_cast<double>(n);
+      (scaled[i] < 1 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+      const std::uint32_t s = small.back();
+      const std::uint32_t l = large.back();
+      small.pop_back();
+      columns_[s] = {static_cast<std::uint64_t>(std::ldexp(scaled[s], 32)), l};
+      scaled[l] = (scaled[l] + scaled[s]) - 1;
+      if (scaled[l] < 1) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // the remaining columns are full (up to the rounding errors)
+    for (std::uint32_t i : large) columns_[i] = {full, i};
+    for (std::uint32_t i : small) columns_[i] = {full, i};
+  }
+
+  template<typename Generator>
+  [[nodiscard]] std::size_t operator()(Generator& g) const
+  {
+    const std::uint64_t bits = random_bits(g);
+    const column& c = columns_[static_cast<std::size_t>(((bits & 0xffffffff) * columns_.size()) >> 32)];
+    return (bits >> 32) < c.threshold ? static_cast<std::size_t>(&c - columns_.data()) : c.alias;
+  }
+
+private:
+  static constexpr std::uint64_t full = std::uint64_t{1} << 32;
+
+  struct column {
+    std::uint64_t threshold;  // the probability of the own index of the column times 2^32
+    std::uint32_t alias;
+  };
+  std::vector<column> columns_;
+};
+
+// the Philox4x32 bijection of a 128-bit counter with a 64-bit key (J. K. Salmon, M. A. Moraes, R. O. Dror,
+// D. E. Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3")
+template<std::size_t Rounds>
+[[nodiscard]] constexpr std::array<std::uint32_t, 4> philox4x32(std::array<std::uint32_t, 4> ctr,
+                                                                std::array<std::uint32_t, 2> key) noexcept
+{
+  for (std::size_t i = 0; i < Rounds; ++i) {
+    if (i > 0) {
+      key[0] += 0x9E3779B9u;
+      key[1] += 0xBB67AE85u;
+    }
+    const std::uint64_t p0 = std::uint64_t{0xD2511F53u} * ctr[0];
+    const std::uint64_t p1 = std::uint64_t{0xCD9E8D57u} * ctr[2];
+    ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(p1),
+           static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(p0)};
+  }
+  return ctr;
+}
+
 }  // namespace detail
 
+/**
+ * @brief A counter-based random number engine
+ *
+ * The n-th number of a stream is the Philox4x32 bijection of the counter made of n and the stream number keyed with
+ * the seed, so there is no state to carry from one number to the next. Thanks to that `discard()` jumps ahead in
+ * constant time, and `split()` creates any of the 2^64 non-overlapping streams of 2^64 numbers of a seed (e.g. one
+ * per thread or per task) without generating anything. Each bijection gives two 64-bit numbers.
+ *
+ * It satisfies `std::uniform_random_bit_generator` and can be used with all the distributions in this header.
+ *
+ * @tparam Rounds the number of the Philox rounds (10 is the recommended value with a safety margin)
+ */
+template<std::size_t Rounds>
+class philox_engine {
+public:
+  using result_type = std::uint64_t;
+  static constexpr result_type default_seed = 20111115u;
+
+  constexpr philox_engine() : philox_engine(default_seed) {}
+  constexpr explicit philox_engine(result_type seed, result_type stream = 0) : seed_(seed), stream_(stream) {}
+
+  constexpr void seed(result_type seed = default_seed, result_type stream = 0)
+  {
+    *this = philox_engine(seed, stream);
+  }
+
+  [[nodiscard]] static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+  [[nodiscard]] static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  constexpr result_type operator()()
+  {
+    if (position_ % 2 == 0) refill();
+    return buffer_[position_++ % 2];
+  }
+
+  constexpr void discard(unsigned long long z)
+  {
+    position_ += z;
+    if (position_ % 2 != 0) refill();
+  }
+
+  // the engine at the beginning of the stream `stream` of the same seed
+  [[nodiscard]] constexpr philox_engine split(result_type stream) const { return philox_engine(seed_, stream); }
+
+  [[nodiscard]] constexpr result_type stream() const { return stream_; }
+
+  // the number of the numbers generated or discarded so far in the stream
+  [[nodiscard]] constexpr std::uint64_t position() const { return position_; }
+
+  [[nodiscard]] friend constexpr bool operator==(const philox_engine& lhs, const philox_engine& rhs)
+  {
+    return lhs.seed_ == rhs.seed_ && lhs.stream_ == rhs.stream_ && lhs.position_ == rhs.position_;
+  }
+
+private:
+  result_type seed_;
+  result_type stream_;
+  std::uint64_t position_ = 0;  // the number of the numbers generated or discarded so far
+  std::array<result_type, 2> buffer_{};
+
+  constexpr void refill()
+  {
+    const std::uint64_t counter = position_ / 2;
+    const auto block = detail::philox4x32<Rounds>(
+      {static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32),
+       static_cast<std::uint32_t>(stream_), static_cast<std::uint32_t>(stream_ >> 32)},
+      {static_cast<std::uint32_t>(seed_), static_cast<std::uint32_t>(seed_ >> 32)});
+    buffer_ = {(std::uint64_t{block[1]} << 32) | block[0], (std::uint64_t{block[3]} << 32) | block[2]};
+  }
+};
+
+using philox4x32_10 = philox_engine<10>;
+
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct uniform_int_distribution : public std::uniform_int_distribution<typename Q::rep> {
+struct uniform_int_distribution :
+    public std::uniform_int_distribution<typename Q::rep>,
+    public detail::bulk_generation<uniform_int_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::uniform_int_distribution<rep>;
 
@@ -105,7 +440,9 @@ struct uniform_int_distribution : public std::uniform_int_distribution<typename
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct uniform_real_distribution : public std::uniform_real_distribution<typename Q::rep> {
+struct uniform_real_distribution :
+    public std::uniform_real_distribution<typename Q::rep>,
+    public detail::bulk_generation<uniform_real_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::uniform_real_distribution<rep>;
 
@@ -118,6 +455,21 @@ struct uniform_real_distribution : public std::uniform_real_distribution<typenam
     return Q(base::operator()(g));
   }
 
+  template<typename Generator, std::output_iterator<Q> OutputIt>
+  OutputIt generate_n(Generator& g, OutputIt first, std::size_t n)
+  {
+    const rep a = base::a();
+    const rep b = base::b();
+    const rep width = b - a;
+    // `a + width * u` may round up to `b` for `u` close to 1 which would break the half-open range `[a, b)`
+    const rep last = std::nextafter(b, a);
+    for (; n > 0; --n) {
+      const rep x = a + width * detail::canonical<rep>(detail::random_bits(g));
+      *first++ = Q(x < b ? x : last);
+    }
+    return first;
+  }
+
   Q a() const { return Q(base::a()); }
   Q b() const { return Q(base::b()); }
 
@@ -127,7 +479,9 @@ struct uniform_real_distribution : public std::uniform_real_distribution<typenam
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct binomial_distribution : public std::binomial_distribution<typename Q::rep> {
+struct binomial_distribution :
+    public std::binomial_distribution<typename Q::rep>,
+    public detail::bulk_generation<binomial_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::binomial_distribution<rep>;
 
@@ -148,7 +502,9 @@ struct binomial_distribution : public std::binomial_distribution<typename Q::rep
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct negative_binomial_distribution : public std::negative_binomial_distribution<typename Q::rep> {
+struct negative_binomial_distribution :
+    public std::negative_binomial_distribution<typename Q::rep>,
+    public detail::bulk_generation<negative_binomial_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::negative_binomial_distribution<rep>;
 
@@ -169,7 +525,9 @@ struct negative_binomial_distribution : public std::negative_binomial_distributi
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct geometric_distribution : public std::geometric_distribution<typename Q::rep> {
+struct geometric_distribution :
+    public std::geometric_distribution<typename Q::rep>,
+    public detail::bulk_generation<geometric_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::geometric_distribution<rep>;
 
@@ -188,7 +546,9 @@ struct geometric_distribution : public std::geometric_distribution<typename Q::r
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct poisson_distribution : public std::poisson_distribution<typename Q::rep> {
+struct poisson_distribution :
+    public std::poisson_distribution<typename Q::rep>,
+    public detail::bulk_generation<poisson_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::poisson_distribution<rep>;
 
@@ -207,7 +567,9 @@ struct poisson_distribution : public std::poisson_distribution<typename Q::rep>
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct exponential_distribution : public std::exponential_distribution<typename Q::rep> {
+struct exponential_distribution :
+    public std::exponential_distribution<typename Q::rep>,
+    public detail::bulk_generation<exponential_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::exponential_distribution<rep>;
 
@@ -220,13 +582,28 @@ struct exponential_distribution : public std::exponential_distribution<typename
     return Q(base::operator()(g));
   }
 
+  template<typename Generator, std::output_iterator<Q> OutputIt>
+  OutputIt generate_n(Generator& g, OutputIt first, std::size_t n)
+  {
+    if constexpr (std::numeric_limits<rep>::digits > std::numeric_limits<double>::digits) {
+      return detail::generate_each(*this, g, first, n);
+    } else {
+      // the Ziggurat method that is faster than the inversion with `log` of the standard library implementations
+      const rep inv_lambda = 1 / base::lambda();
+      for (; n > 0; --n) *first++ = Q(static_cast<rep>(detail::standard_exponential(g)) * inv_lambda);
+      return first;
+    }
+  }
+
   Q min() const { return Q(base::min()); }
   Q max() const { return Q(base::max()); }
 };
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct gamma_distribution : public std::gamma_distribution<typename Q::rep> {
+struct gamma_distribution :
+    public std::gamma_distribution<typename Q::rep>,
+    public detail::bulk_generation<gamma_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::gamma_distribution<rep>;
 
@@ -245,7 +622,9 @@ struct gamma_distribution : public std::gamma_distribution<typename Q::rep> {
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct weibull_distribution : public std::weibull_distribution<typename Q::rep> {
+struct weibull_distribution :
+    public std::weibull_distribution<typename Q::rep>,
+    public detail::bulk_generation<weibull_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::weibull_distribution<rep>;
 
@@ -264,7 +643,9 @@ struct weibull_distribution : public std::weibull_distribution<typename Q::rep>
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct extreme_value_distribution : public std::extreme_value_distribution<typename Q::rep> {
+struct extreme_value_distribution :
+    public std::extreme_value_distribution<typename Q::rep>,
+    public detail::bulk_generation<extreme_value_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::extreme_value_distribution<rep>;
 
@@ -285,7 +666,9 @@ struct extreme_value_distribution : public std::extreme_value_distribution<typen
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct normal_distribution : public std::normal_distribution<typename Q::rep> {
+struct normal_distribution :
+    public std::normal_distribution<typename Q::rep>,
+    public detail::bulk_generation<normal_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::normal_distribution<rep>;
 
@@ -298,6 +681,20 @@ struct normal_distribution : public std::normal_distribution<typename Q::rep> {
     return Q(base::operator()(g));
   }
 
+  template<typename Generator, std::output_iterator<Q> OutputIt>
+  OutputIt generate_n(Generator& g, OutputIt first, std::size_t n)
+  {
+    if constexpr (std::numeric_limits<rep>::digits > std::numeric_limits<double>::digits) {
+      return detail::generate_each(*this, g, first, n);
+    } else {
+      // the Ziggurat method that is faster than the Marsaglia polar method of the standard library implementations
+      const rep mean = base::mean();
+      const rep stddev = base::stddev();
+      for (; n > 0; --n) *first++ = Q(mean + stddev * static_cast<rep>(detail::standard_normal(g)));
+      return first;
+    }
+  }
+
   Q mean() const { return Q(base::mean()); }
   Q stddev() const { return Q(base::stddev()); }
 
@@ -307,7 +704,9 @@ struct normal_distribution : public std::normal_distribution<typename Q::rep> {
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct lognormal_distribution : public std::lognormal_distribution<typename Q::rep> {
+struct lognormal_distribution :
+    public std::lognormal_distribution<typename Q::rep>,
+    public detail::bulk_generation<lognormal_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::lognormal_distribution<rep>;
 
@@ -329,7 +728,9 @@ struct lognormal_distribution : public std::lognormal_distribution<typename Q::r
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct chi_squared_distribution : public std::chi_squared_distribution<typename Q::rep> {
+struct chi_squared_distribution :
+    public std::chi_squared_distribution<typename Q::rep>,
+    public detail::bulk_generation<chi_squared_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::chi_squared_distribution<rep>;
 
@@ -348,7 +749,9 @@ struct chi_squared_distribution : public std::chi_squared_distribution<typename
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct cauchy_distribution : public std::cauchy_distribution<typename Q::rep> {
+struct cauchy_distribution :
+    public std::cauchy_distribution<typename Q::rep>,
+    public detail::bulk_generation<cauchy_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::cauchy_distribution<rep>;
 
@@ -370,7 +773,9 @@ struct cauchy_distribution : public std::cauchy_distribution<typename Q::rep> {
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct fisher_f_distribution : public std::fisher_f_distribution<typename Q::rep> {
+struct fisher_f_distribution :
+    public std::fisher_f_distribution<typename Q::rep>,
+    public detail::bulk_generation<fisher_f_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::fisher_f_distribution<rep>;
 
@@ -389,7 +794,9 @@ struct fisher_f_distribution : public std::fisher_f_distribution<typename Q::rep
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct student_t_distribution : public std::student_t_distribution<typename Q::rep> {
+struct student_t_distribution :
+    public std::student_t_distribution<typename Q::rep>,
+    public detail::bulk_generation<student_t_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::student_t_distribution<rep>;
 
@@ -408,7 +815,9 @@ struct student_t_distribution : public std::student_t_distribution<typename Q::r
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct discrete_distribution : public std::discrete_distribution<typename Q::rep> {
+struct discrete_distribution :
+    public std::discrete_distribution<typename Q::rep>,
+    public detail::bulk_generation<discrete_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::discrete_distribution<rep>;
 
@@ -439,17 +848,22 @@ struct discrete_distribution : public std::discrete_distribution<typename Q::rep
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-class piecewise_constant_distribution : public std::piecewise_constant_distribution<typename Q::rep> {
+class piecewise_constant_distribution :
+    public std::piecewise_constant_distribution<typename Q::rep>,
+    public detail::bulk_generation<piecewise_constant_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::piecewise_constant_distribution<rep>;
 
-  template<typename InputIt>
-  piecewise_constant_distribution(const std::vector<rep>& i, InputIt first_w) : base(i.cbegin(), i.cend(), first_w)
+  template<std::ranges::input_range I, std::input_iterator InputIt>
+    requires std::same_as<std::ranges::range_value_t<I>, rep>
+  piecewise_constant_distribution(I&& i, InputIt first_w) : base(std::ranges::begin(i), std::ranges::end(i), first_w)
   {
   }
 
-  piecewise_constant_distribution(const std::vector<rep>& bl, const std::vector<rep>& weights) :
-      base(bl.cbegin(), bl.cend(), weights.cbegin())
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, rep>
+  piecewise_constant_distribution(I&& bl, W&& weights) :
+      base(std::ranges::begin(bl), std::ranges::end(bl), std::ranges::begin(weights))
   {
   }
 
@@ -458,7 +872,15 @@ public:
 
   template<typename InputIt1, typename InputIt2>
   piecewise_constant_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
-      piecewise_constant_distribution(detail::i_qty_to_rep<Q>(first_i, last_i), first_w)
+      piecewise_constant_distribution(detail::i_qty_to_rep(first_i, last_i), first_w)
+  {
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::ranges::common_range<I> && std::same_as<std::ranges::range_value_t<I>, Q>
+  piecewise_constant_distribution(const I& intervals, const W& weights) :
+      piecewise_constant_distribution(detail::i_qty_to_rep(std::ranges::begin(intervals), std::ranges::end(intervals)),
+                                     std::ranges::begin(weights))
   {
   }
 
@@ -497,17 +919,22 @@ public:
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-class piecewise_linear_distribution : public std::piecewise_linear_distribution<typename Q::rep> {
+class piecewise_linear_distribution :
+    public std::piecewise_linear_distribution<typename Q::rep>,
+    public detail::bulk_generation<piecewise_linear_distribution<Q>, Q> {
   using rep = TYPENAME Q::rep;
   using base = TYPENAME std::piecewise_linear_distribution<rep>;
 
-  template<typename InputIt>
-  piecewise_linear_distribution(const std::vector<rep>& i, InputIt first_w) : base(i.cbegin(), i.cend(), first_w)
+  template<std::ranges::input_range I, std::input_iterator InputIt>
+    requires std::same_as<std::ranges::range_value_t<I>, rep>
+  piecewise_linear_distribution(I&& i, InputIt first_w) : base(std::ranges::begin(i), std::ranges::end(i), first_w)
   {
   }
 
-  piecewise_linear_distribution(const std::vector<rep>& bl, const std::vector<rep>& weights) :
-      base(bl.cbegin(), bl.cend(), weights.cbegin())
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, rep>
+  piecewise_linear_distribution(I&& bl, W&& weights) :
+      base(std::ranges::begin(bl), std::ranges::end(bl), std::ranges::begin(weights))
   {
   }
 
@@ -516,7 +943,15 @@ public:
 
   template<typename InputIt1, typename InputIt2>
   piecewise_linear_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
-      piecewise_linear_distribution(detail::i_qty_to_rep<Q>(first_i, last_i), first_w)
+      piecewise_linear_distribution(detail::i_qty_to_rep(first_i, last_i), first_w)
+  {
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::ranges::common_range<I> && std::same_as<std::ranges::range_value_t<I>, Q>
+  piecewise_linear_distribution(const I& intervals, const W& weights) :
+      piecewise_linear_distribution(detail::i_qty_to_rep(std::ranges::begin(intervals), std::ranges::end(intervals)),
+                                    std::ranges::begin(weights))
   {
   }
 
@@ -553,4 +988,531 @@ public:
   Q max() const { return Q(base::max()); }
 };
 
+/**
+ * @brief A piecewise constant distribution of at most `MaxIntervals` intervals stored in place
+ *
+ * It has the constructors of @c piecewise_constant_distribution, and the `assign()` overloads with the same
+ * parameters re-parameterize it in place without any allocations (e.g. at each step of a simulation).
+ */
+template<Quantity Q, std::size_t MaxIntervals>
+  requires std::floating_point<typename Q::rep> && (MaxIntervals > 0)
+class fixed_piecewise_constant_distribution :
+    public detail::bulk_generation<fixed_piecewise_constant_distribution<Q, MaxIntervals>, Q> {
+public:
+  using rep = TYPENAME Q::rep;
+  static constexpr std::size_t max_intervals = MaxIntervals;
+
+  fixed_piecewise_constant_distribution() { assign(); }
+
+  template<std::input_iterator InputIt1, std::input_iterator InputIt2>
+  fixed_piecewise_constant_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w)
+  {
+    assign(first_i, last_i, first_w);
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, Q>
+  fixed_piecewise_constant_distribution(const I& intervals, const W& weights)
+  {
+    assign(intervals, weights);
+  }
+
+  template<typename UnaryOperation>
+  fixed_piecewise_constant_distribution(std::initializer_list<Q> bl, UnaryOperation fw)
+  {
+    assign(bl, fw);
+  }
+
+  template<typename UnaryOperation>
+  fixed_piecewise_constant_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw)
+  {
+    assign(nw, xmin, xmax, fw);
+  }
+
+  void assign()
+  {
+    intervals_[0] = Q::zero();
+    intervals_[1] = Q(rep{1});
+    n_ = 1;
+    const rep weight = 1;
+    set_weights(&weight);
+  }
+
+  template<std::input_iterator InputIt1, std::input_iterator InputIt2>
+  void assign(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w)
+  {
+    if (detail::set_intervals(intervals_, n_, first_i, last_i))
+      set_weights(first_w);
+    else
+      assign();
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, Q>
+  void assign(const I& intervals, const W& weights)
+  {
+    assign(std::ranges::begin(intervals), std::ranges::end(intervals), std::ranges::begin(weights));
+  }
+
+  template<typename UnaryOperation>
+  void assign(std::initializer_list<Q> bl, UnaryOperation fw)
+  {
+    assign(bl.begin(), bl.end(), detail::fw_bl_pwc(bl, fw).begin());
+  }
+
+  template<typename UnaryOperation>
+  void assign(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw)
+  {
+    const rep delta = detail::set_intervals(intervals_, n_, nw, xmin, xmax);
+    set_weights((std::views::iota(std::size_t{0}, n_) | std::views::transform([&](std::size_t i) -> rep {
+                   return fw(Q(intervals_[i].number() + rep{0.5} * delta));
+                 })).begin());
+  }
+
+  template<typename Generator>
+  Q operator()(Generator& g)
+  {
+    const auto [i, u] = detail::select_interval(cumulative_, n_, g);
+    return Q(intervals_[i].number() + u / densities_[i]);
+  }
+
+  std::span<const Q> intervals() const { return {intervals_.data(), n_ + 1}; }
+  std::span<const rep> densities() const { return {densities_.data(), n_}; }
+
+  Q min() const { return intervals_[0]; }
+  Q max() const { return intervals_[n_]; }
+
+private:
+  std::size_t n_ = 0;  // the number of the intervals
+  std::array<Q, MaxIntervals + 1> intervals_;
+  std::array<rep, MaxIntervals> densities_;
+  std::array<rep, MaxIntervals> cumulative_;
+
+  template<typename InputIt>
+  void set_weights(InputIt first_w)
+  {
+    rep sum = 0;
+    for (std::size_t i = 0; i < n_; ++i, ++first_w) {
+      densities_[i] = static_cast<rep>(*first_w);
+      gsl_Expects(densities_[i] >= 0);
+      sum += densities_[i];
+    }
+    gsl_Expects(sum > 0);
+
+    rep cumulative = 0;
+    for (std::size_t i = 0; i < n_; ++i) {
+      densities_[i] /= sum;
+      cumulative += densities_[i];
+      cumulative_[i] = cumulative;
+      densities_[i] /= (intervals_[i + 1] - intervals_[i]).number();
+    }
+  }
+};
+
+/**
+ * @brief A piecewise linear distribution of at most `MaxIntervals` intervals stored in place
+ *
+ * It has the constructors of @c piecewise_linear_distribution, and the `assign()` overloads with the same
+ * parameters re-parameterize it in place without any allocations (e.g. at each step of a simulation).
+ */
+template<Quantity Q, std::size_t MaxIntervals>
+  requires std::floating_point<typename Q::rep> && (MaxIntervals > 0)
+class fixed_piecewise_linear_distribution :
+    public detail::bulk_generation<fixed_piecewise_linear_distribution<Q, MaxIntervals>, Q> {
+public:
+  using rep = TYPENAME Q::rep;
+  static constexpr std::size_t max_intervals = MaxIntervals;
+
+  fixed_piecewise_linear_distribution() { assign(); }
+
+  template<std::input_iterator InputIt1, std::input_iterator InputIt2>
+  fixed_piecewise_linear_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w)
+  {
+    assign(first_i, last_i, first_w);
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, Q>
+  fixed_piecewise_linear_distribution(const I& intervals, const W& weights)
+  {
+    assign(intervals, weights);
+  }
+
+  template<typename UnaryOperation>
+  fixed_piecewise_linear_distribution(std::initializer_list<Q> bl, UnaryOperation fw)
+  {
+    assign(bl, fw);
+  }
+
+  template<typename UnaryOperation>
+  fixed_piecewise_linear_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw)
+  {
+    assign(nw, xmin, xmax, fw);
+  }
+
+  void assign()
+  {
+    intervals_[0] = Q::zero();
+    intervals_[1] = Q(rep{1});
+    n_ = 1;
+    const std::array<rep, 2> weights = {1, 1};
+    set_weights(weights.begin());
+  }
+
+  template<std::input_iterator InputIt1, std::input_iterator InputIt2>
+  void assign(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w)
+  {
+    if (detail::set_intervals(intervals_, n_, first_i, last_i))
+      set_weights(first_w);
+    else
+      assign();
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, Q>
+  void assign(const I& intervals, const W& weights)
+  {
+    assign(std::ranges::begin(intervals), std::ranges::end(intervals), std::ranges::begin(weights));
+  }
+
+  template<typename UnaryOperation>
+  void assign(std::initializer_list<Q> bl, UnaryOperation fw)
+  {
+    assign(bl.begin(), bl.end(), detail::fw_bl_pwl(bl, fw).begin());
+  }
+
+  template<typename UnaryOperation>
+  void assign(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw)
+  {
+    detail::set_intervals(intervals_, n_, nw, xmin, xmax);
+    set_weights((std::views::iota(std::size_t{0}, n_ + 1) |
+                 std::views::transform([&](std::size_t i) -> rep { return fw(intervals_[i]); }))
+                  .begin());
+  }
+
+  template<typename Generator>
+  Q operator()(Generator& g)
+  {
+    // the root of `densities_[i] * x + slopes_[i] * x^2 / 2 == u` without the cancellation of the textbook formula
+    const auto [i, u] = detail::select_interval(cumulative_, n_, g);
+    const rep d = densities_[i];
+    const rep den = d + std::sqrt(d * d + 2 * slopes_[i] * u);
+    return Q(intervals_[i].number() + (den > 0 ? 2 * u / den : rep{0}));
+  }
+
+  std::span<const Q> intervals() const { return {intervals_.data(), n_ + 1}; }
+  std::span<const rep> densities() const { return {densities_.data(), n_ + 1}; }
+
+  Q min() const { return intervals_[0]; }
+  Q max() const { return intervals_[n_]; }
+
+private:
+  std::size_t n_ = 0;  // the number of the intervals
+  std::array<Q, MaxIntervals + 1> intervals_;
+  std::array<rep, MaxIntervals + 1> densities_;
+  std::array<rep, MaxIntervals> slopes_;
+  std::array<rep, MaxIntervals> cumulative_;
+
+  template<typename InputIt>
+  void set_weights(InputIt first_w)
+  {
+    for (std::size_t i = 0; i <= n_; ++i, ++first_w) {
+      densities_[i] = static_cast<rep>(*first_w);
+      gsl_Expects(densities_[i] >= 0);
+    }
+
+    rep sum = 0;
+    for (std::size_t i = 0; i < n_; ++i) {
+      const rep delta = (intervals_[i + 1] - intervals_[i]).number();
+      sum += rep{0.5} * (densities_[i + 1] + densities_[i]) * delta;
+      cumulative_[i] = sum;
+      slopes_[i] = (densities_[i + 1] - densities_[i]) / delta;
+    }
+    gsl_Expects(sum > 0);
+
+    for (std::size_t i = 0; i < n_; ++i) {
+      cumulative_[i] /= sum;
+      slopes_[i] /= sum;
+    }
+    for (std::size_t i = 0; i <= n_; ++i) densities_[i] /= sum;
+  }
+};
+
+/**
+ * @brief A discrete distribution sampled with an alias table
+ *
+ * It has the interface of @c discrete_distribution, but each number is generated in constant time (one random
+ * number and one table lookup) instead of with a binary search over the cumulative probabilities. `operator()` is
+ * `const`, so one instance can be shared by many threads (each with its own engine).
+ */
+template<Quantity Q>
+  requires std::integral<typename Q::rep>
+class alias_discrete_distribution : public detail::bulk_generation<alias_discrete_distribution<Q>, Q> {
+public:
+  using rep = TYPENAME Q::rep;
+
+  alias_discrete_distribution() : alias_discrete_distribution({1.0}) {}
+
+  template<std::input_iterator InputIt>
+  alias_discrete_distribution(InputIt first, InputIt last) : probabilities_(first, last)
+  {
+    init();
+  }
+
+  template<std::ranges::input_range W>
+  explicit alias_discrete_distribution(const W& weights) :
+      alias_discrete_distribution(std::ranges::begin(weights), std::ranges::end(weights))
+  {
+  }
+
+  alias_discrete_distribution(std::initializer_list<double> weights) :
+      alias_discrete_distribution(weights.begin(), weights.end())
+  {
+  }
+
+  template<typename UnaryOperation>
+  alias_discrete_distribution(std::size_t count, double xmin, double xmax, UnaryOperation unary_op)
+  {
+    const std::size_t n = count == 0 ? 1 : count;
+    const double delta = (xmax - xmin) / static_cast<double>(n);
+    probabilities_.reserve(n);
+    for (std::size_t k = 0; k < n; ++k)
+      probabilities_.push_back(unary_op(xmin + static_cast<double>(k) * delta + 0.5 * delta));
+    init();
+  }
+
+  template<typename Generator>
+  Q operator()(Generator& g) const
+  {
+    return Q(static_cast<rep>(table_(g)));
+  }
+
+  const std::vector<double>& probabilities() const { return probabilities_; }
+
+  Q min() const { return Q::zero(); }
+  Q max() const { return Q(static_cast<rep>(probabilities_.size() - 1)); }
+
+private:
+  std::vector<double> probabilities_;
+  detail::alias_table table_;
+
+  void init()
+  {
+    if (probabilities_.empty()) probabilities_.push_back(1.0);
+    double sum = 0;
+    for (double w : probabilities_) {
+      gsl_Expects(w >= 0);
+      sum += w;
+    }
+    gsl_Expects(sum > 0);
+    for (double& p : probabilities_) p /= sum;
+    table_ = detail::alias_table(probabilities_);
+  }
+};
+
+/**
+ * @brief A piecewise constant distribution sampled with an alias table
+ *
+ * It has the interface of @c piecewise_constant_distribution, but the interval is selected in constant time (one
+ * random number and one table lookup) instead of with a binary search over the cumulative probabilities. `operator()`
+ * is `const`, so one instance can be shared by many threads (each with its own engine).
+ */
+template<Quantity Q>
+  requires std::floating_point<typename Q::rep>
+class alias_piecewise_constant_distribution :
+    public detail::bulk_generation<alias_piecewise_constant_distribution<Q>, Q> {
+public:
+  using rep = TYPENAME Q::rep;
+
+  alias_piecewise_constant_distribution() :
+      alias_piecewise_constant_distribution(1, Q::zero(), Q(rep{1}), [](Q) { return 1; })
+  {
+  }
+
+  template<std::input_iterator InputIt1, std::input_iterator InputIt2>
+  alias_piecewise_constant_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
+      intervals_(first_i, last_i)
+  {
+    if (intervals_.size() < 2) {
+      *this = alias_piecewise_constant_distribution();
+      return;
+    }
+    densities_.reserve(intervals_.size() - 1);
+    for (std::size_t i = 0; i + 1 < intervals_.size(); ++i, ++first_w)
+      densities_.push_back(static_cast<rep>(*first_w));
+    init();
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, Q>
+  alias_piecewise_constant_distribution(const I& intervals, const W& weights) :
+      alias_piecewise_constant_distribution(std::ranges::begin(intervals), std::ranges::end(intervals),
+                                            std::ranges::begin(weights))
+  {
+  }
+
+  template<typename UnaryOperation>
+  alias_piecewise_constant_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
+      alias_piecewise_constant_distribution(bl.begin(), bl.end(), detail::fw_bl_pwc(bl, fw).begin())
+  {
+  }
+
+  template<typename UnaryOperation>
+  alias_piecewise_constant_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw)
+  {
+    const std::size_t n = nw == 0 ? 1 : nw;
+    const rep delta = (xmax - xmin).number() / static_cast<rep>(n);
+    intervals_.reserve(n + 1);
+    for (std::size_t i = 0; i <= n; ++i) intervals_.push_back(Q(xmin.number() + static_cast<rep>(i) * delta));
+    densities_.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+      densities_.push_back(static_cast<rep>(fw(Q(intervals_[i].number() + rep{0.5} * delta))));
+    init();
+  }
+
+  template<typename Generator>
+  Q operator()(Generator& g) const
+  {
+    const std::size_t i = table_(g);
+    return intervals_[i] + (intervals_[i + 1] - intervals_[i]) * detail::canonical<rep>(detail::random_bits(g));
+  }
+
+  const std::vector<Q>& intervals() const { return intervals_; }
+  const std::vector<rep>& densities() const { return densities_; }
+
+  Q min() const { return intervals_.front(); }
+  Q max() const { return intervals_.back(); }
+
+private:
+  std::vector<Q> intervals_;
+  std::vector<rep> densities_;
+  detail::alias_table table_;
+
+  void init()
+  {
+    rep sum = 0;
+    for (rep w : densities_) {
+      gsl_Expects(w >= 0);
+      sum += w;
+    }
+    gsl_Expects(sum > 0);
+
+    std::vector<double> probabilities(densities_.size());
+    for (std::size_t i = 0; i < densities_.size(); ++i) {
+      densities_[i] /= sum;
+      probabilities[i] = static_cast<double>(densities_[i]);
+      densities_[i] /= (intervals_[i + 1] - intervals_[i]).number();
+    }
+    table_ = detail::alias_table(probabilities);
+  }
+};
+
+/**
+ * @brief A piecewise linear distribution sampled with an alias table
+ *
+ * It has the interface of @c piecewise_linear_distribution, but the interval is selected in constant time (one
+ * random number and one table lookup) instead of with a binary search over the cumulative probabilities. `operator()`
+ * is `const`, so one instance can be shared by many threads (each with its own engine).
+ */
+template<Quantity Q>
+  requires std::floating_point<typename Q::rep>
+class alias_piecewise_linear_distribution : public detail::bulk_generation<alias_piecewise_linear_distribution<Q>, Q> {
+public:
+  using rep = TYPENAME Q::rep;
+
+  alias_piecewise_linear_distribution() :
+      alias_piecewise_linear_distribution(1, Q::zero(), Q(rep{1}), [](Q) { return 1; })
+  {
+  }
+
+  template<std::input_iterator InputIt1, std::input_iterator InputIt2>
+  alias_piecewise_linear_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
+      intervals_(first_i, last_i)
+  {
+    if (intervals_.size() < 2) {
+      *this = alias_piecewise_linear_distribution();
+      return;
+    }
+    densities_.reserve(intervals_.size());
+    for (std::size_t i = 0; i < intervals_.size(); ++i, ++first_w) densities_.push_back(static_cast<rep>(*first_w));
+    init();
+  }
+
+  template<std::ranges::input_range I, std::ranges::input_range W>
+    requires std::same_as<std::ranges::range_value_t<I>, Q>
+  alias_piecewise_linear_distribution(const I& intervals, const W& weights) :
+      alias_piecewise_linear_distribution(std::ranges::begin(intervals), std::ranges::end(intervals),
+                                          std::ranges::begin(weights))
+  {
+  }
+
+  template<typename UnaryOperation>
+  alias_piecewise_linear_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
+      alias_piecewise_linear_distribution(bl.begin(), bl.end(), detail::fw_bl_pwl(bl, fw).begin())
+  {
+  }
+
+  template<typename UnaryOperation>
+  alias_piecewise_linear_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw)
+  {
+    const std::size_t n = nw == 0 ? 1 : nw;
+    const rep delta = (xmax - xmin).number() / static_cast<rep>(n);
+    intervals_.reserve(n + 1);
+    for (std::size_t i = 0; i <= n; ++i) intervals_.push_back(Q(xmin.number() + static_cast<rep>(i) * delta));
+    densities_.reserve(n + 1);
+    for (const Q& b : intervals_) densities_.push_back(static_cast<rep>(fw(b)));
+    init();
+  }
+
+  template<typename Generator>
+  Q operator()(Generator& g) const
+  {
+    // the root of `densities_[i] * x + slopes_[i] * x^2 / 2 == u` without the cancellation of the textbook formula
+    const std::size_t i = table_(g);
+    const rep u = areas_[i] * detail::canonical<rep>(detail::random_bits(g));
+    const rep d = densities_[i];
+    const rep den = d + std::sqrt(d * d + 2 * slopes_[i] * u);
+    return Q(intervals_[i].number() + (den > 0 ? 2 * u / den : rep{0}));
+  }
+
+  const std::vector<Q>& intervals() const { return intervals_; }
+  const std::vector<rep>& densities() const { return densities_; }
+
+  Q min() const { return intervals_.front(); }
+  Q max() const { return intervals_.back(); }
+
+private:
+  std::vector<Q> intervals_;
+  std::vector<rep> densities_;
+  std::vector<rep> slopes_;
+  std::vector<rep> areas_;
+  detail::alias_table table_;
+
+  void init()
+  {
+    gsl_Expects(std::ranges::all_of(densities_, [](rep w) { return w >= 0; }));
+
+    const std::size_t n = intervals_.size() - 1;
+    slopes_.resize(n);
+    areas_.resize(n);
+    rep sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const rep delta = (intervals_[i + 1] - intervals_[i]).number();
+      areas_[i] = rep{0.5} * (densities_[i + 1] + densities_[i]) * delta;
+      sum += areas_[i];
+      slopes_[i] = (densities_[i + 1] - densities_[i]) / delta;
+    }
+    gsl_Expects(sum > 0);
+
+    std::vector<double> probabilities(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      areas_[i] /= sum;
+      slopes_[i] /= sum;
+      probabilities[i] = static_cast<double>(areas_[i]);
+    }
+    for (rep& d : densities_) d /= sum;
+    table_ = detail::alias_table(probabilities);
+  }
+};
+
 }  // namespace units
@@ -0,0 +1,485 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/int128.h>
+#include <units/customization_points.h>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace units {
+
+/**
+ * @brief A signed integer of `N` bits
+ *
+ * A portable two's complement integer wider than the built-in ones to be used as a representation type of quantities
+ * with large numbers (e.g. the storage capacities in bits) or large conversion magnitudes, so that `quantity_cast`
+ * between their units is exact and does not overflow:
+ *
+ * @code{.cpp}
+ * using namespace units::isq::iec80000;
+ * storage_capacity<yottabyte, units::wide_int<128>> c(5);
+ * auto b = units::quantity_cast<bit>(c);  // 40'000'000'000'000'000'000'000'000 bit
+ * @endcode
+ *
+ * Like for the unsigned built-in integers, the arithmetic wraps around on overflow. The division rounds toward zero.
+ * The numbers are printed with `operator<<` (honoring the `std::ios_base::basefield`, `showbase`, `showpos`, and
+ * `uppercase` flags) and formatted with `units/format.h`.
+ *
+ * @tparam N the number of the bits (a multiple of 64 of at least 128)
+ */
+template<std::size_t N>
+  requires(N >= 128 && N % 64 == 0)
+class wide_int {
+  static constexpr std::size_t word_count = N / 64;
+  using words_type = std::array<std::uint64_t, word_count>;
+
+public:
+  wide_int() = default;
+
+  template<std::integral T>
+  constexpr wide_int(T v) noexcept : words_(extend(static_cast<std::uint64_t>(v), std::is_signed_v<T> && v < 0))
+  {
+  }
+
+#if defined(__SIZEOF_INT128__)
+  constexpr wide_int(detail::int128_t v) noexcept : words_(extend(static_cast<detail::uint128_t>(v), v < 0)) {}
+  constexpr wide_int(detail::uint128_t v) noexcept : words_(extend(v, false)) {}
+#endif
+
+  template<std::size_t M>
+    requires(M != N)
+  constexpr explicit(M > N) wide_int(const wide_int<M>& v) noexcept
+  {
+    const bool negative = v < 0;
+    for (std::size_t i = 0; i < word_count; ++i)
+      words_[i] = i < wide_int<M>::word_count ? v.words_[i] : (negative ? ~std::uint64_t{0} : 0);
+  }
+
+  // rounds toward zero
+  template<std::floating_point T>
+  constexpr explicit wide_int(T v) noexcept
+  {
+    long double x = v < 0 ? -static_cast<long double>(v) : static_cast<long double>(v);
+    for (std::size_t i = word_count; i-- > 0;) {
+      const long double p = word_weight(i);
+      const auto w = static_cast<std::uint64_t>(x / p);
+      words_[i] = w;
+      x -= static_cast<long double>(w) * p;
+    }
+    if (v < 0) words_ = negate(words_);
+  }
+
+  // the lowest bits of the number (wraps around like the conversions of the built-in integers)
+  template<std::integral T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept
+  {
+    if constexpr (std::same_as<T, bool>)
+      return *this != wide_int{};
+    else
+      return static_cast<T>(words_[0]);
+  }
+
+#if defined(__SIZEOF_INT128__)
+  [[nodiscard]] constexpr explicit operator detail::int128_t() const noexcept
+  {
+    return static_cast<detail::int128_t>(static_cast<detail::uint128_t>(*this));
+  }
+
+  [[nodiscard]] constexpr explicit operator detail::uint128_t() const noexcept
+  {
+    return static_cast<detail::uint128_t>(words_[1]) << 64 | words_[0];
+  }
+#endif
+
+  template<std::floating_point T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept
+  {
+    const words_type m = magnitude(words_);
+    long double x = 0;
+    for (std::size_t i = word_count; i-- > 0;) x += static_cast<long double>(m[i]) * word_weight(i);
+    return static_cast<T>(is_negative(words_) ? -x : x);
+  }
+
+  [[nodiscard]] constexpr wide_int operator+() const noexcept { return *this; }
+  [[nodiscard]] constexpr wide_int operator-() const noexcept { return from_words(negate(words_)); }
+
+  [[nodiscard]] constexpr wide_int operator~() const noexcept
+  {
+    wide_int r;
+    for (std::size_t i = 0; i < word_count; ++i) r.words_[i] = ~words_[i];
+    return r;
+  }
+
+  constexpr wide_int& operator++() noexcept { return *this += 1; }
+  constexpr wide_int& operator--() noexcept { return *this -= 1; }
+
+  constexpr wide_int operator++(int) noexcept
+  {
+    wide_int tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  constexpr wide_int operator--(int) noexcept
+  {
+    wide_int tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  constexpr wide_int& operator+=(const wide_int& rhs) noexcept
+  {
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < word_count; ++i) {
+      const std::uint64_t sum = words_[i] + rhs.words_[i];
+      const std::uint64_t result = sum + carry;
+      carry = static_cast<std::uint64_t>(sum < words_[i]) + static_cast<std::uint64_t>(result < sum);
+      words_[i] = result;
+    }
+    return *this;
+  }
+
+  constexpr wide_int& operator-=(const wide_int& rhs) noexcept
+  {
+    subtract(words_, rhs.words_);
+    return *this;
+  }
+
+  // the lowest `N` bits of the product
+  constexpr wide_int& operator*=(const wide_int& rhs) noexcept
+  {
+    words_type r{};
+    for (std::size_t i = 0; i < word_count; ++i) {
+      if (words_[i] == 0) continue;
+      std::uint64_t carry = 0;
+      for (std::size_t j = 0; i + j < word_count; ++j) {
+        const detail::uint64_pair p = detail::umul128(words_[i], rhs.words_[j]);
+        const std::uint64_t lo = p.lo + carry;
+        const std::uint64_t sum = r[i + j] + lo;
+        carry = p.hi + static_cast<std::uint64_t>(lo < p.lo) + static_cast<std::uint64_t>(sum < lo);
+        r[i + j] = sum;
+      }
+    }
+    words_ = r;
+    return *this;
+  }
+
+  constexpr wide_int& operator/=(const wide_int& rhs) noexcept
+  {
+    words_type rem{};
+    words_type q = divide(magnitude(words_), magnitude(rhs.words_), rem);
+    words_ = is_negative(words_) != is_negative(rhs.words_) ? negate(q) : q;
+    return *this;
+  }
+
+  constexpr wide_int& operator%=(const wide_int& rhs) noexcept
+  {
+    words_type rem{};
+    (void)divide(magnitude(words_), magnitude(rhs.words_), rem);
+    words_ = is_negative(words_) ? negate(rem) : rem;
+    return *this;
+  }
+
+  constexpr wide_int& operator&=(const wide_int& rhs) noexcept
+  {
+    for (std::size_t i = 0; i < word_count; ++i) words_[i] &= rhs.words_[i];
+    return *this;
+  }
+
+  constexpr wide_int& operator|=(const wide_int& rhs) noexcept
+  {
+    for (std::size_t i = 0; i < word_count; ++i) words_[i] |= rhs.words_[i];
+    return *this;
+  }
+
+  constexpr wide_int& operator^=(const wide_int& rhs) noexcept
+  {
+    for (std::size_t i = 0; i < word_count; ++i) words_[i] ^= rhs.words_[i];
+    return *this;
+  }
+
+  constexpr wide_int& operator<<=(int n) noexcept
+  {
+    words_ = shift_left(words_, n);
+    return *this;
+  }
+
+  // arithmetic shift
+  constexpr wide_int& operator>>=(int n) noexcept
+  {
+    const std::uint64_t fill = is_negative(words_) ? ~std::uint64_t{0} : 0;
+    const auto word_shift = static_cast<std::size_t>(n / 64);
+    const int bit_shift = n % 64;
+    for (std::size_t i = 0; i < word_count; ++i) {
+      const std::size_t src = i + word_shift;
+      const std::uint64_t lo = src < word_count ? words_[src] : fill;
+      const std::uint64_t hi = src + 1 < word_count ? words_[src + 1] : fill;
+      words_[i] = bit_shift == 0 ? lo : (lo >> bit_shift) | (hi << (64 - bit_shift));
+    }
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr wide_int operator+(wide_int lhs, const wide_int& rhs) noexcept { return lhs += rhs; }
+  [[nodiscard]] friend constexpr wide_int operator-(wide_int lhs, const wide_int& rhs) noexcept { return lhs -= rhs; }
+  [[nodiscard]] friend constexpr wide_int operator*(wide_int lhs, const wide_int& rhs) noexcept { return lhs *= rhs; }
+  [[nodiscard]] friend constexpr wide_int operator/(wide_int lhs, const wide_int& rhs) noexcept { return lhs /= rhs; }
+  [[nodiscard]] friend constexpr wide_int operator%(wide_int lhs, const wide_int& rhs) noexcept { return lhs %= rhs; }
+  [[nodiscard]] friend constexpr wide_int operator&(wide_int lhs, const wide_int& rhs) noexcept { return lhs &= rhs; }
+  [[nodiscard]] friend constexpr wide_int operator|(wide_int lhs, const wide_int& rhs) noexcept { return lhs |= rhs; }
+  [[nodiscard]] friend constexpr wide_int operator^(wide_int lhs, const wide_int& rhs) noexcept { return lhs ^= rhs; }
+  [[nodiscard]] friend constexpr wide_int operator<<(wide_int lhs, int n) noexcept { return lhs <<= n; }
+  [[nodiscard]] friend constexpr wide_int operator>>(wide_int lhs, int n) noexcept { return lhs >>= n; }
+
+  [[nodiscard]] friend constexpr bool operator==(const wide_int&, const wide_int&) = default;
+
+  [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const wide_int& lhs, const wide_int& rhs) noexcept
+  {
+    if (is_negative(lhs.words_) != is_negative(rhs.words_))
+      return is_negative(lhs.words_) ? std::strong_ordering::less : std::strong_ordering::greater;
+    return compare(lhs.words_, rhs.words_);
+  }
+
+  /**
+   * @brief The digits of the number in the base of 2 to 36 (with the lowercase letters) preceded with '-' if negative
+   */
+  [[nodiscard]] friend std::string to_string(const wide_int& v, int base = 10)
+  {
+    words_type m = magnitude(v.words_);
+    std::string digits;
+    do {
+      const auto d = static_cast<char>(divide_small(m, static_cast<std::uint32_t>(base)));
+      digits.insert(digits.begin(), d < 10 ? static_cast<char>('0' + d) : static_cast<char>('a' + d - 10));
+    } while (m != words_type{});
+    if (is_negative(v.words_)) digits.insert(digits.begin(), '-');
+    return digits;
+  }
+
+  template<typename CharT, typename Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const wide_int& v)
+  {
+    using ios = std::basic_ios<CharT, Traits>;
+    const auto flags = os.flags();
+    const auto basefield = flags & ios::basefield;
+    const int base = basefield == ios::hex ? 16 : basefield == ios::oct ? 8 : 10;
+    std::string s = to_string(v, base);
+    const bool negative = s.front() == '-';
+    if (negative) s.erase(s.begin());
+    if (flags & ios::uppercase)
+      for (char& c : s) c = static_cast<char>(c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c);
+    if ((flags & ios::showbase) && base != 10) s.insert(0, base == 8 ? "0" : (flags & ios::uppercase) ? "0X" : "0x");
+    if (negative)
+      s.insert(s.begin(), '-');
+    else if ((flags & ios::showpos) && base == 10)
+      s.insert(s.begin(), '+');
+    std::basic_string<CharT, Traits> out;
+    for (char c : s) out.push_back(os.widen(c));
+    return os << out;
+  }
+
+private:
+  template<std::size_t M>
+    requires(M >= 128 && M % 64 == 0)
+  friend class wide_int;
+
+  words_type words_{};
+
+  [[nodiscard]] static constexpr wide_int from_words(const words_type& w) noexcept
+  {
+    wide_int r;
+    r.words_ = w;
+    return r;
+  }
+
+  template<typename T>
+  [[nodiscard]] static constexpr words_type extend(T v, bool negative) noexcept
+  {
+    words_type w{};
+    for (std::size_t i = 0; i < word_count; ++i) {
+      if (i * 64 < sizeof(T) * 8)
+        w[i] = static_cast<std::uint64_t>(v >> (i * 64));
+      else
+        w[i] = negative ? ~std::uint64_t{0} : 0;
+    }
+    return w;
+  }
+
+  // 2^(64 * i)
+  [[nodiscard]] static constexpr long double word_weight(std::size_t i) noexcept
+  {
+    long double p = 1;
+    for (std::size_t k = 0; k < i; ++k) p *= 0x1p64L;
+    return p;
+  }
+
+  [[nodiscard]] static constexpr bool is_negative(const words_type& w) noexcept { return w.back() >> 63; }
+
+  [[nodiscard]] static constexpr words_type negate(words_type w) noexcept
+  {
+    bool carry = true;
+    for (auto& word : w) {
+      word = ~word + static_cast<std::uint64_t>(carry);
+      carry = carry && word == 0;
+    }
+    return w;
+  }
+
+  [[nodiscard]] static constexpr words_type magnitude(const words_type& w) noexcept
+  {
+    return is_negative(w) ? negate(w) : w;
+  }
+
+  static constexpr void subtract(words_type& lhs, const words_type& rhs) noexcept
+  {
+    std::uint64_t borrow = 0;
+    for (std::size_t i = 0; i < word_count; ++i) {
+      const std::uint64_t diff = lhs[i] - rhs[i];
+      const std::uint64_t result = diff - borrow;
+      borrow = static_cast<std::uint64_t>(lhs[i] < rhs[i]) + static_cast<std::uint64_t>(diff < borrow);
+      lhs[i] = result;
+    }
+  }
+
+  // the comparison of the unsigned numbers
+  [[nodiscard]] static constexpr std::strong_ordering compare(const words_type& lhs, const words_type& rhs) noexcept
+  {
+    for (std::size_t i = word_count; i-- > 0;)
+      if (lhs[i] != rhs[i]) return lhs[i] <=> rhs[i];
+    return std::strong_ordering::equal;
+  }
+
+  [[nodiscard]] static constexpr words_type shift_left(const words_type& w, int n) noexcept
+  {
+    words_type r{};
+    const auto word_shift = static_cast<std::size_t>(n / 64);
+    const int bit_shift = n % 64;
+    for (std::size_t i = word_count; i-- > word_shift;) {
+      const std::size_t src = i - word_shift;
+      r[i] = w[src] << bit_shift;
+      if (bit_shift != 0 && src > 0) r[i] |= w[src - 1] >> (64 - bit_shift);
+    }
+    return r;
+  }
+
+  // divides the unsigned number by `d` in place and returns the remainder
+  static constexpr std::uint32_t divide_small(words_type& w, std::uint32_t d) noexcept
+  {
+    std::uint64_t rem = 0;
+    for (std::size_t i = word_count; i-- > 0;) {
+      const std::uint64_t hi = (rem << 32) | (w[i] >> 32);
+      const std::uint64_t lo = ((hi % d) << 32) | (w[i] & 0xffff'ffff);
+      w[i] = (hi / d) << 32 | (lo / d);
+      rem = lo % d;
+    }
+    return static_cast<std::uint32_t>(rem);
+  }
+
+  // the quotient and the remainder of the unsigned numbers
+  [[nodiscard]] static constexpr words_type divide(words_type u, const words_type& d, words_type& rem) noexcept
+  {
+    bool small = d[0] <= 0xffff'ffff;
+    for (std::size_t i = 1; i < word_count; ++i) small = small && d[i] == 0;
+    if (small) {
+      rem = words_type{divide_small(u, static_cast<std::uint32_t>(d[0]))};
+      return u;
+    }
+
+    // the binary long division starting from the highest set bit
+    words_type q{};
+    rem = words_type{};
+    std::size_t top = word_count;
+    while (top > 0 && u[top - 1] == 0) --top;
+    if (top == 0) return q;
+    for (std::size_t bit = top * 64 - static_cast<std::size_t>(std::countl_zero(u[top - 1])); bit-- > 0;) {
+      rem = shift_left(rem, 1);
+      rem[0] |= (u[bit / 64] >> (bit % 64)) & 1;
+      if (compare(rem, d) >= 0) {
+        subtract(rem, d);
+        q[bit / 64] |= std::uint64_t{1} << (bit % 64);
+      }
+    }
+    return q;
+  }
+};
+
+}  // namespace units
+
+template<std::size_t N>
+class std::numeric_limits<units::wide_int<N>> {
+public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = true;
+  static constexpr bool is_exact = true;
+  static constexpr bool has_infinity = false;
+  static constexpr bool has_quiet_NaN = false;
+  static constexpr bool has_signaling_NaN = false;
+  static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+  static constexpr bool has_denorm_loss = false;
+  static constexpr std::float_round_style round_style = std::round_toward_zero;
+  static constexpr bool is_iec559 = false;
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = true;
+  static constexpr int digits = static_cast<int>(N - 1);
+  static constexpr int digits10 = static_cast<int>((N - 1) * 30103 / 100000);
+  static constexpr int max_digits10 = 0;
+  static constexpr int radix = 2;
+  static constexpr int min_exponent = 0;
+  static constexpr int min_exponent10 = 0;
+  static constexpr int max_exponent = 0;
+  static constexpr int max_exponent10 = 0;
+  // the division by zero traps like the one of the built-in integers used for the words
+  static constexpr bool traps = std::numeric_limits<std::uint64_t>::traps;
+  static constexpr bool tinyness_before = false;
+
+  [[nodiscard]] static constexpr units::wide_int<N> min() noexcept
+  {
+    return units::wide_int<N>(1) << static_cast<int>(N - 1);
+  }
+  [[nodiscard]] static constexpr units::wide_int<N> lowest() noexcept { return min(); }
+  [[nodiscard]] static constexpr units::wide_int<N> max() noexcept { return ~min(); }
+  [[nodiscard]] static constexpr units::wide_int<N> epsilon() noexcept { return 0; }
+  [[nodiscard]] static constexpr units::wide_int<N> round_error() noexcept { return 0; }
+  [[nodiscard]] static constexpr units::wide_int<N> infinity() noexcept { return 0; }
+  [[nodiscard]] static constexpr units::wide_int<N> quiet_NaN() noexcept { return 0; }
+  [[nodiscard]] static constexpr units::wide_int<N> signaling_NaN() noexcept { return 0; }
+  [[nodiscard]] static constexpr units::wide_int<N> denorm_min() noexcept { return 0; }
+};
+
+template<std::size_t N, std::floating_point T>
+struct std::common_type<units::wide_int<N>, T> {
+  using type = T;
+};
+
+template<std::floating_point T, std::size_t N>
+struct std::common_type<T, units::wide_int<N>> {
+  using type = T;
+};
@@ -0,0 +1,88 @@
+
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// IWYU pragma: begin_exports
+#include <units/format.h>
+#include <units/isq/si/acceleration.h>
+#include <units/isq/si/area.h>
+#include <units/isq/si/energy.h>
+#include <units/isq/si/force.h>
+#include <units/isq/si/frequency.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/mass.h>
+#include <units/isq/si/power.h>
+#include <units/isq/si/pressure.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/thermodynamic_temperature.h>
+#include <units/isq/si/time.h>
+#include <units/isq/si/volume.h>
+#include <units/quantity_io.h>
+// IWYU pragma: end_exports
+
+#include <ostream>
+
+/**
+ * @brief Explicitly instantiates (or declares as `extern`) the text output of a quantity type
+ *
+ * Covers only the members that are costly to compile: the output stream operator and the `format()`
+ * member function of the formatter for `char` and the default format context. The rest of the quantity
+ * class template is cheap and mostly `constexpr`, so it is still instantiated implicitly where used
+ * (and inlined).
+ *
+ * @param EXTERN either `extern` or empty
+ * @param Q a quantity type
+ */
+#define UNITS_QUANTITY_INSTANTIATION(EXTERN, Q)                                                                  \
+  EXTERN template std::ostream& units::operator<<(std::ostream&, const Q&);                                      \
+  EXTERN template UNITS_STD_FMT::format_context::iterator UNITS_STD_FMT::formatter<Q, char>::format(             \
+    const Q&, UNITS_STD_FMT::format_context&)
+
+/**
+ * @brief Applies `UNITS_QUANTITY_INSTANTIATION` to the most frequently used SI quantities
+ *
+ * The instantiations are compiled into `mp-units::si-instantiations` library (one translation unit per quantity,
+ * so a program links only the instantiations it uses).
+ *
+ * @param EXTERN either `extern` or empty
+ */
+#define UNITS_SI_INSTANTIATIONS(EXTERN)                                                                          \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::length<units::isq::si::metre>);                           \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::length<units::isq::si::kilometre>);                       \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::time<units::isq::si::second>);                            \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::time<units::isq::si::hour>);                              \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::mass<units::isq::si::kilogram>);                          \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::thermodynamic_temperature<units::isq::si::kelvin>);       \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::area<units::isq::si::square_metre>);                      \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::volume<units::isq::si::cubic_metre>);                     \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::frequency<units::isq::si::hertz>);                        \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::speed<units::isq::si::metre_per_second>);                 \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::speed<units::isq::si::kilometre_per_hour>);               \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::acceleration<units::isq::si::metre_per_second_sq>);       \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::force<units::isq::si::newton>);                           \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::pressure<units::isq::si::pascal>);                        \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::energy<units::isq::si::joule>);                           \
+  UNITS_QUANTITY_INSTANTIATION(EXTERN, units::isq::si::power<units::isq::si::watt>)
+
+UNITS_SI_INSTANTIATIONS(extern);
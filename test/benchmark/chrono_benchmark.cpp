@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <units/chrono.h>
+#include <units/isq/si/time.h>
+#include <chrono>
+#include <cstddef>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+constexpr std::size_t count = 100'000;
+
+// the sum of the numbers of the time points so that the reads of the clock are not optimized away
+template<typename F>
+auto accumulate(F now)
+{
+  decltype(now()) sum{};
+  for (std::size_t i = 0; i < count; ++i) sum += now();
+  return sum;
+}
+
+}  // namespace
+
+TEST_CASE("reading clocks as quantity points", "[chrono][!benchmark]")
+{
+  tsc_clock::calibrate();
+
+  BENCHMARK("std::chrono::steady_clock::now()")
+  {
+    return accumulate([] { return std::chrono::steady_clock::now().time_since_epoch().count(); });
+  };
+  BENCHMARK("clock_now<std::chrono::steady_clock>()")
+  {
+    return accumulate([] { return clock_now<std::chrono::steady_clock>().relative().number(); });
+  };
+  BENCHMARK("clock_now<std::chrono::steady_clock, si::second, double>()")
+  {
+    return accumulate([] { return clock_now<std::chrono::steady_clock, si::second, double>().relative().number(); });
+  };
+
+  BENCHMARK("std::chrono::system_clock::now()")
+  {
+    return accumulate([] { return std::chrono::system_clock::now().time_since_epoch().count(); });
+  };
+  BENCHMARK("clock_now<std::chrono::system_clock>()")
+  {
+    return accumulate([] { return clock_now<std::chrono::system_clock>().relative().number(); });
+  };
+
+  BENCHMARK("tsc_clock::now()")
+  {
+    return accumulate([] { return tsc_clock::now().time_since_epoch().count(); });
+  };
+  BENCHMARK("clock_now<tsc_clock>()")
+  {
+    return accumulate([] { return clock_now<tsc_clock>().relative().number(); });
+  };
+}
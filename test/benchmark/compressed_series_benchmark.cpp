@@ -0,0 +1,119 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <units/chrono.h>
+#include <units/compressed_series.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/time.h>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+constexpr std::size_t count = 1'000'000;
+
+using timestamp = quantity_point<clock_origin<std::chrono::system_clock>, si::millisecond, std::int64_t>;
+using length_point = quantity_point<dynamic_origin<si::dim_length>, si::metre>;
+
+// the timestamps of a logger sampling at 4 Hz with a jitter
+std::vector<timestamp> timestamps()
+{
+  std::vector<timestamp> v;
+  std::int64_t t = 1'650'000'000'000;
+  for (std::size_t i = 0; i < count; ++i) {
+    t += 250 + static_cast<std::int64_t>(i % 7 == 0) - static_cast<std::int64_t>(i % 11 == 0);
+    v.push_back(timestamp(si::time<si::millisecond, std::int64_t>(t)));
+  }
+  return v;
+}
+
+// the altitudes of a glider rounded to centimetres
+std::vector<length_point> altitudes()
+{
+  std::vector<length_point> v;
+  for (std::size_t i = 0; i < count; ++i) {
+    const double t = static_cast<double>(i) / 4;
+    v.push_back(length_point(si::length<si::metre>(std::round(120'000 + 30'000 * std::sin(t / 120)) / 100)));
+  }
+  return v;
+}
+
+template<typename Series, typename T>
+Series compress(const std::vector<T>& v)
+{
+  Series s;
+  for (const auto& p : v) s.push_back(p);
+  s.shrink_to_fit();
+  return s;
+}
+
+// the sum of the numbers of the points so that the decoding is not optimized away
+template<typename Range>
+auto sum(const Range& r)
+{
+  typename Range::value_type::rep result{};
+  for (const auto& p : r) result += p.relative().number();
+  return result;
+}
+
+template<typename Range>
+auto sum_strided(const Range& r)
+{
+  typename Range::value_type::rep result{};
+  for (std::size_t i = 0; i < r.size(); i += 1009) result += r[i].relative().number();
+  return result;
+}
+
+}  // namespace
+
+TEST_CASE("compressed series of timestamps", "[compressed_series][!benchmark]")
+{
+  const auto v = timestamps();
+  const auto s = compress<compressed_series<timestamp>>(v);
+  WARN("delta-of-delta: " << s.bytes() << " bytes instead of " << v.size() * sizeof(timestamp));
+
+  BENCHMARK("push_back") { return compress<compressed_series<timestamp>>(v).size(); };
+  BENCHMARK("iterating std::vector") { return sum(v); };
+  BENCHMARK("iterating compressed_series") { return sum(s); };
+  BENCHMARK("indexing std::vector") { return sum_strided(v); };
+  BENCHMARK("indexing compressed_series") { return sum_strided(s); };
+}
+
+TEST_CASE("compressed series of altitudes", "[compressed_series][!benchmark]")
+{
+  const auto v = altitudes();
+  const auto s = compress<compressed_series<length_point>>(v);
+  WARN("XOR: " << s.bytes() << " bytes instead of " << v.size() * sizeof(length_point));
+
+  BENCHMARK("push_back") { return compress<compressed_series<length_point>>(v).size(); };
+  BENCHMARK("iterating std::vector") { return sum(v); };
+  BENCHMARK("iterating compressed_series") { return sum(s); };
+  BENCHMARK("indexing std::vector") { return sum_strided(v); };
+  BENCHMARK("indexing compressed_series") { return sum_strided(s); };
+}
@@ -0,0 +1,352 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <units/generic/angle.h>
+#include <units/generic/dimensionless.h>
+#include <units/isq/si/area.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/volume.h>
+#include <units/fast_math.h>
+#include <units/lookup_table.h>
+#include <units/math.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+template<typename Rep>
+std::vector<si::length<si::metre, Rep>> random_lengths(std::size_t count)
+{
+  std::mt19937 gen(42);  // fixed seed to have repeatable results
+  std::uniform_real_distribution<double> dist(1., 1000.);
+  std::vector<si::length<si::metre, Rep>> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) result.emplace_back(static_cast<Rep>(dist(gen)));
+  return result;
+}
+
+template<typename F>
+auto accumulate(const auto& input, F f)
+{
+  decltype(f(input.front())) sum{};
+  for (const auto& q : input) sum += f(q);
+  return sum;
+}
+
+constexpr std::size_t count = 10'000;
+
+}  // namespace
+
+TEST_CASE("'pow<N>()' with integral exponents", "[math][pow][!benchmark]")
+{
+  const auto input = random_lengths<double>(count);
+
+  BENCHMARK("pow<2>(q)") { return accumulate(input, [](const auto& q) { return pow<2>(q); }); };
+  BENCHMARK("std::pow(v, 2.)") { return accumulate(input, [](const auto& q) { return std::pow(q.number(), 2.); }); };
+  BENCHMARK("pow<3>(q)") { return accumulate(input, [](const auto& q) { return pow<3>(q); }); };
+  BENCHMARK("std::pow(v, 3.)") { return accumulate(input, [](const auto& q) { return std::pow(q.number(), 3.); }); };
+  BENCHMARK("pow<-2>(q)") { return accumulate(input, [](const auto& q) { return pow<-2>(q); }); };
+  BENCHMARK("std::pow(v, -2.)") { return accumulate(input, [](const auto& q) { return std::pow(q.number(), -2.); }); };
+}
+
+TEST_CASE("'pow<N>()' with integral exponents and integral representation", "[math][pow][!benchmark]")
+{
+  const auto input = random_lengths<std::int64_t>(count);
+
+  BENCHMARK("pow<2>(q)") { return accumulate(input, [](const auto& q) { return pow<2>(q); }); };
+  BENCHMARK("std::pow(v, 2.)")
+  {
+    return accumulate(input, [](const auto& q) { return static_cast<std::int64_t>(std::pow(q.number(), 2.)); });
+  };
+}
+
+TEST_CASE("'pow<Num, Den>()' with rational exponents", "[math][pow][!benchmark]")
+{
+  const auto input = random_lengths<double>(count);
+
+  BENCHMARK("pow<1, 2>(q)") { return accumulate(input, [](const auto& q) { return pow<1, 2>(q); }); };
+  BENCHMARK("std::pow(v, 0.5)") { return accumulate(input, [](const auto& q) { return std::pow(q.number(), 0.5); }); };
+  BENCHMARK("pow<1, 3>(q)") { return accumulate(input, [](const auto& q) { return pow<1, 3>(q); }); };
+  BENCHMARK("std::pow(v, 1. / 3)")
+  {
+    return accumulate(input, [](const auto& q) { return std::pow(q.number(), 1. / 3); });
+  };
+}
+
+TEST_CASE("math functions on ranges of quantities", "[math][range][!benchmark]")
+{
+  const auto lengths = random_lengths<double>(count);
+  std::vector<si::length<si::kilometre>> lengths_km;
+  std::vector<si::area<si::square_metre>> areas;
+  std::vector<angle<degree>> angles;
+  std::vector<dimensionless<percent>> percents;
+  for (const auto& l : lengths) {
+    lengths_km.emplace_back(l.number() / 1000);
+    areas.emplace_back(l.number());
+    angles.emplace_back(l.number());
+    percents.emplace_back(l.number() / 100);
+  }
+  std::vector<si::length<si::metre>> out_lengths(count);
+  // spans of dimensionless quantities are created from pointers as the iterator concepts checks of
+  // `std::vector<dimensionless<one>>::iterator` (also used by `back()`) recurse into the dimensionless
+  // `operator-()` overloads
+  std::vector<dimensionless<one>> out_numbers(count);
+  std::vector<dimensionless<percent>> out_percents(count);
+
+  BENCHMARK("sqrt(q) loop")
+  {
+    for (std::size_t i = 0; i < count; ++i) out_lengths[i] = sqrt(areas[i]);
+    return out_lengths.back();
+  };
+  BENCHMARK("sqrt(range)")
+  {
+    sqrt(std::span(areas), std::span(out_lengths));
+    return out_lengths.back();
+  };
+
+  BENCHMARK("hypot(q1, q2) loop")
+  {
+    for (std::size_t i = 0; i < count; ++i) out_lengths[i] = hypot(lengths[i], lengths_km[i]);
+    return out_lengths.back();
+  };
+  BENCHMARK("hypot(range1, range2)")
+  {
+    hypot(std::span(lengths), std::span(lengths_km), std::span(out_lengths));
+    return out_lengths.back();
+  };
+
+  BENCHMARK("sin(degrees) loop")
+  {
+    for (std::size_t i = 0; i < count; ++i) out_numbers[i] = sin(angles[i]);
+    return out_numbers[count - 1];
+  };
+  BENCHMARK("sin(range of degrees)")
+  {
+    sin(std::span(angles), std::span(out_numbers.data(), count));
+    return out_numbers[count - 1];
+  };
+
+  BENCHMARK("cos(degrees) loop")
+  {
+    for (std::size_t i = 0; i < count; ++i) out_numbers[i] = cos(angles[i]);
+    return out_numbers[count - 1];
+  };
+  BENCHMARK("cos(range of degrees)")
+  {
+    cos(std::span(angles), std::span(out_numbers.data(), count));
+    return out_numbers[count - 1];
+  };
+
+  BENCHMARK("exp(percents) loop")
+  {
+    for (std::size_t i = 0; i < count; ++i) out_percents[i] = exp(percents[i]);
+    return out_percents[count - 1];
+  };
+  BENCHMARK("exp(range of percents)")
+  {
+    exp(std::span(std::as_const(percents).data(), count), std::span(out_percents.data(), count));
+    return out_percents[count - 1];
+  };
+}
+
+TEST_CASE("fast trigonometric functions", "[math][fast][!benchmark]")
+{
+  const auto lengths = random_lengths<double>(count);
+  std::vector<angle<degree>> degrees;
+  std::vector<angle<radian>> radians;
+  std::vector<angle<degree, float>> degrees_float;
+  for (const auto& l : lengths) {
+    degrees.emplace_back(l.number());
+    radians.emplace_back(l.number() / 100);
+    degrees_float.emplace_back(static_cast<float>(l.number()));
+  }
+
+  BENCHMARK("sin(degrees)") { return accumulate(degrees, [](const auto& a) { return sin(a).number(); }); };
+  BENCHMARK("fast::sin(degrees)") { return accumulate(degrees, [](const auto& a) { return fast::sin(a).number(); }); };
+  BENCHMARK("sin(radians)") { return accumulate(radians, [](const auto& a) { return sin(a).number(); }); };
+  BENCHMARK("fast::sin(radians)") { return accumulate(radians, [](const auto& a) { return fast::sin(a).number(); }); };
+  BENCHMARK("sin(float degrees)")
+  {
+    return accumulate(degrees_float, [](const auto& a) { return sin(a).number(); });
+  };
+  BENCHMARK("fast::sin(float degrees)")
+  {
+    return accumulate(degrees_float, [](const auto& a) { return fast::sin(a).number(); });
+  };
+  BENCHMARK("tan(degrees)") { return accumulate(degrees, [](const auto& a) { return tan(a).number(); }); };
+  BENCHMARK("fast::tan(degrees)") { return accumulate(degrees, [](const auto& a) { return fast::tan(a).number(); }); };
+
+  std::vector<si::length<si::metre>> xs(lengths.rbegin(), lengths.rend());
+  BENCHMARK("atan2(y, x) with std::atan2")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += std::atan2(lengths[i].number(), xs[i].number());
+    return sum;
+  };
+  BENCHMARK("fast::atan2(y, x)")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += fast::atan2(lengths[i], xs[i]).number();
+    return sum;
+  };
+  BENCHMARK("fast::atan2<degree>(y, x)")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += fast::atan2<degree>(lengths[i], xs[i]).number();
+    return sum;
+  };
+}
+
+TEST_CASE("'sincos()' and 'atan2()'", "[math][sincos][!benchmark]")
+{
+  const auto lengths = random_lengths<double>(count);
+  std::vector<angle<degree>> degrees;
+  std::vector<si::length<si::kilometre>> lengths_km;
+  for (const auto& l : lengths) {
+    degrees.emplace_back(l.number());
+    lengths_km.emplace_back(l.number() / 1000);
+  }
+  std::vector<dimensionless<one>> sines(count);
+  std::vector<dimensionless<one>> cosines(count);
+  std::vector<angle<radian>> angles(count);
+
+  BENCHMARK("sin(a) and cos(a)")
+  {
+    return accumulate(degrees, [](const auto& a) { return sin(a).number() + cos(a).number(); });
+  };
+  BENCHMARK("sincos(a)")
+  {
+    return accumulate(degrees, [](const auto& a) {
+      const auto [s, c] = sincos(a);
+      return s.number() + c.number();
+    });
+  };
+  BENCHMARK("sincos(range)")
+  {
+    sincos(std::span(degrees), std::span(sines.data(), count), std::span(cosines.data(), count));
+    return sines[count - 1];
+  };
+
+  BENCHMARK("atan2(y, x) through the common type")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      using type = std::common_type_t<si::length<si::metre>, si::length<si::kilometre>>;
+      sum += std::atan2(type(lengths[i]).number(), type(lengths_km[i]).number());
+    }
+    return sum;
+  };
+  BENCHMARK("atan2(y, x)")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += atan2(lengths[i], lengths_km[i]).number();
+    return sum;
+  };
+  BENCHMARK("atan2(range1, range2)")
+  {
+    atan2(std::span(lengths), std::span(lengths_km), std::span(angles));
+    return angles.back();
+  };
+}
+
+TEST_CASE("'norm()' of many quantities", "[math][norm][!benchmark]")
+{
+  const auto lengths = random_lengths<double>(6 * count);
+
+  BENCHMARK("chained hypot(x, y) of 6 quantities")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < lengths.size(); i += 6)
+      sum += hypot(hypot(hypot(hypot(hypot(lengths[i], lengths[i + 1]), lengths[i + 2]), lengths[i + 3]),
+                         lengths[i + 4]),
+                   lengths[i + 5])
+               .number();
+    return sum;
+  };
+  BENCHMARK("norm(...) of 6 quantities")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < lengths.size(); i += 6)
+      sum += norm(lengths[i], lengths[i + 1], lengths[i + 2], lengths[i + 3], lengths[i + 4], lengths[i + 5]).number();
+    return sum;
+  };
+  BENCHMARK("norm(range) of 6 quantities")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < lengths.size(); i += 6) sum += norm(std::span(lengths).subspan(i, 6)).number();
+    return sum;
+  };
+
+  BENCHMARK("chained hypot(x, y) of a range")
+  {
+    auto res = lengths.front();
+    for (std::size_t i = 1; i < lengths.size(); ++i) res = hypot(res, lengths[i]);
+    return res;
+  };
+  BENCHMARK("norm(range)") { return norm(std::span(lengths)); };
+}
+
+TEST_CASE("'lookup_table' of a glider polar", "[lookup_table][!benchmark]")
+{
+  using kmph = si::speed<si::kilometre_per_hour>;
+  using mps = si::speed<si::metre_per_second>;
+  constexpr auto polar = [](const kmph& v) {
+    const double x = v.number();
+    return mps(-0.0000551 * x * x + 0.0108 * x - 1.22);
+  };
+  static constexpr lookup_table<kmph, mps, 64> linear(polar, kmph(70), kmph(250));
+  static constexpr lookup_table<kmph, mps, 64, interpolation::cubic> cubic(polar, kmph(70), kmph(250));
+
+  // the run-time interpolation of the same samples
+  std::vector<double> xs;
+  std::vector<double> ys;
+  for (std::size_t i = 0; i < 64; ++i) {
+    xs.push_back(70. + 180. * static_cast<double>(i) / 63);
+    ys.push_back(linear.values()[i]);
+  }
+  const auto interpolate = [&](double x) {
+    const auto it = std::clamp(std::upper_bound(xs.begin(), xs.end(), x), xs.begin() + 1, xs.end() - 1);
+    const auto i = static_cast<std::size_t>(it - xs.begin());
+    return ys[i - 1] + (x - xs[i - 1]) / (xs[i] - xs[i - 1]) * (ys[i] - ys[i - 1]);
+  };
+
+  std::mt19937 gen(42);  // fixed seed to have repeatable results
+  std::uniform_real_distribution<double> dist(20., 70.);
+  std::vector<mps> input;
+  for (std::size_t i = 0; i < count; ++i) input.emplace_back(dist(gen));
+
+  BENCHMARK("std::vector interpolation") {
+    return accumulate(input, [&](const mps& v) { return interpolate(quantity_cast<kmph>(v).number()); });
+  };
+  BENCHMARK("linear lookup_table") { return accumulate(input, [](const mps& v) { return linear(v); }); };
+  BENCHMARK("cubic lookup_table") { return accumulate(input, [](const mps& v) { return cubic(v); }); };
+  BENCHMARK("direct evaluation") { return accumulate(input, [&](const mps& v) { return polar(v); }); };
+}
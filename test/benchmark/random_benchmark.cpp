@@ -0,0 +1,141 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <units/isq/si/length.h>
+#include <units/random.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+constexpr std::size_t count = 1'000'000;
+
+template<typename Distribution, typename Q>
+auto loop(Distribution& dist, std::mt19937_64& gen, std::vector<Q>& out)
+{
+  for (auto& q : out) q = dist(gen);
+  return out.back();
+}
+
+template<typename Distribution, typename Q>
+auto bulk(Distribution& dist, std::mt19937_64& gen, std::vector<Q>& out)
+{
+  dist.generate(gen, out);
+  return out.back();
+}
+
+}  // namespace
+
+TEST_CASE("bulk generation of random quantities", "[random][!benchmark]")
+{
+  using q = si::length<si::metre>;
+  std::mt19937_64 gen(42);  // fixed seed to have repeatable results
+  std::vector<q> out(count);
+
+  auto uniform = units::uniform_real_distribution<q>(q(2), q(5));
+  BENCHMARK("uniform_real_distribution: operator()") { return loop(uniform, gen, out); };
+  BENCHMARK("uniform_real_distribution: generate()") { return bulk(uniform, gen, out); };
+
+  auto exponential = units::exponential_distribution<q>(0.5);
+  BENCHMARK("exponential_distribution: operator()") { return loop(exponential, gen, out); };
+  BENCHMARK("exponential_distribution: generate()") { return bulk(exponential, gen, out); };
+
+  auto normal = units::normal_distribution<q>(q(5), q(2));
+  BENCHMARK("normal_distribution: operator()") { return loop(normal, gen, out); };
+  BENCHMARK("normal_distribution: generate()") { return bulk(normal, gen, out); };
+
+  auto gamma = units::gamma_distribution<q>(2.0, 1.0);
+  BENCHMARK("gamma_distribution: operator()") { return loop(gamma, gen, out); };
+  BENCHMARK("gamma_distribution: generate()") { return bulk(gamma, gen, out); };
+}
+
+TEST_CASE("re-parameterization of piecewise quantity distributions", "[random][!benchmark]")
+{
+  using q = si::length<si::metre>;
+  constexpr std::size_t bins = 64;
+  constexpr std::size_t steps = 10'000;
+
+  std::vector<q> intervals(bins + 1);
+  std::vector<double> weights(bins + 1);
+  for (std::size_t i = 0; i <= bins; ++i) {
+    intervals[i] = q(static_cast<double>(i));
+    weights[i] = static_cast<double>(i % 7 + 1);
+  }
+
+  BENCHMARK("piecewise_linear_distribution: construction")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < steps; ++i) {
+      weights[i % bins] += 1;
+      sum += units::piecewise_linear_distribution<q>(intervals, weights).max().number();
+    }
+    return sum;
+  };
+
+  auto fixed = units::fixed_piecewise_linear_distribution<q, bins>();
+  BENCHMARK("fixed_piecewise_linear_distribution: assign()")
+  {
+    double sum = 0;
+    for (std::size_t i = 0; i < steps; ++i) {
+      weights[i % bins] += 1;
+      fixed.assign(intervals, weights);
+      sum += fixed.max().number();
+    }
+    return sum;
+  };
+}
+
+TEST_CASE("sampling of discrete and piecewise quantity distributions", "[random][!benchmark]")
+{
+  using q = si::length<si::metre>;
+  constexpr std::size_t bins = 4096;
+  std::mt19937_64 gen(42);  // fixed seed to have repeatable results
+
+  std::vector<q> intervals(bins + 1);
+  std::vector<double> weights(bins + 1);
+  for (std::size_t i = 0; i <= bins; ++i) {
+    intervals[i] = q(static_cast<double>(i));
+    weights[i] = static_cast<double>(i % 37 + 1);
+  }
+
+  std::vector<si::length<si::metre, std::int64_t>> indices(count);
+  auto discrete = units::discrete_distribution<si::length<si::metre, std::int64_t>>(weights.begin(), weights.end());
+  BENCHMARK("discrete_distribution") { return loop(discrete, gen, indices); };
+  auto alias_discrete = units::alias_discrete_distribution<si::length<si::metre, std::int64_t>>(weights);
+  BENCHMARK("alias_discrete_distribution") { return loop(alias_discrete, gen, indices); };
+
+  std::vector<q> out(count);
+  auto constant = units::piecewise_constant_distribution<q>(intervals, weights);
+  BENCHMARK("piecewise_constant_distribution") { return loop(constant, gen, out); };
+  auto alias_constant = units::alias_piecewise_constant_distribution<q>(intervals, weights);
+  BENCHMARK("alias_piecewise_constant_distribution") { return loop(alias_constant, gen, out); };
+
+  auto linear = units::piecewise_linear_distribution<q>(intervals, weights);
+  BENCHMARK("piecewise_linear_distribution") { return loop(linear, gen, out); };
+  auto alias_linear = units::alias_piecewise_linear_distribution<q>(intervals, weights);
+  BENCHMARK("alias_piecewise_linear_distribution") { return loop(alias_linear, gen, out); };
+}
@@ -0,0 +1,76 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/chrono.h>
+#include <units/isq/si/time.h>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace units;
+using namespace units::isq;
+using namespace std::chrono_literals;
+
+TEST_CASE("clock_now")
+{
+  SECTION("steady_clock")
+  {
+    const auto before = std::chrono::steady_clock::now();
+    const auto now = clock_now<std::chrono::steady_clock>();
+    const auto after = std::chrono::steady_clock::now();
+
+    CHECK(to_std_time_point(now) >= before);
+    CHECK(to_std_time_point(now) <= after);
+  }
+
+  SECTION("system_clock in a different unit and representation")
+  {
+    const auto before = quantity_point{std::chrono::system_clock::now()};
+    const auto now = clock_now<std::chrono::system_clock, si::second, double>();
+    const auto after = quantity_point{std::chrono::system_clock::now()};
+
+    CHECK(now.relative() >= quantity_cast<si::time<si::second>>(before.relative()) - si::time<si::second>(1e-6));
+    CHECK(now.relative() <= quantity_cast<si::time<si::second>>(after.relative()) + si::time<si::second>(1e-6));
+  }
+
+  SECTION("tsc_clock")
+  {
+    tsc_clock::calibrate();
+
+    // monotonic
+    auto prev = clock_now<tsc_clock>();
+    for (int i = 0; i < 1000; ++i) {
+      const auto now = clock_now<tsc_clock>();
+      CHECK(now >= prev);
+      prev = now;
+    }
+
+    // on the time scale of steady_clock (up to the error of the calibration)
+    std::this_thread::sleep_for(50ms);
+    const auto before = std::chrono::steady_clock::now();
+    const auto now = tsc_clock::now();
+    const auto after = std::chrono::steady_clock::now();
+    CHECK(now.time_since_epoch() >= before.time_since_epoch() - 1ms);
+    CHECK(now.time_since_epoch() <= after.time_since_epoch() + 1ms);
+  }
+}
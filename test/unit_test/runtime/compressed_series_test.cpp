@@ -0,0 +1,195 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/chrono.h>
+#include <units/compressed_series.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/time.h>
+#include <units/kind.h>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+using timestamp = quantity_point<clock_origin<std::chrono::system_clock>, si::millisecond, std::int64_t>;
+
+struct vertical_kind : kind<vertical_kind, si::dim_length> {};
+struct vertical_point_kind : point_kind<vertical_point_kind, vertical_kind> {};
+using altitude = quantity_point_kind<vertical_point_kind, si::metre>;
+
+// the timestamps of a logger sampling at 4 Hz with a jitter and an occasional gap
+std::vector<timestamp> logger_timestamps(std::size_t n)
+{
+  std::vector<timestamp> v;
+  std::int64_t t = 1'650'000'000'000;
+  for (std::size_t i = 0; i < n; ++i) {
+    t += 250 + static_cast<std::int64_t>(i % 7 == 0) - static_cast<std::int64_t>(i % 11 == 0);
+    if (i % 1000 == 999) t += 60'000;
+    v.push_back(timestamp(si::time<si::millisecond, std::int64_t>(t)));
+  }
+  return v;
+}
+
+// the altitudes of a glider climbing in a thermal and gliding between them
+std::vector<altitude> glider_altitudes(std::size_t n)
+{
+  std::vector<altitude> v;
+  for (std::size_t i = 0; i < n; ++i) {
+    const double t = static_cast<double>(i) / 4;
+    v.push_back(altitude(si::length<si::metre>(1200 + 300 * std::sin(t / 120) + std::round(t * 10) / 100)));
+  }
+  return v;
+}
+
+}  // namespace
+
+TEST_CASE("compressed_series selects the encoding by the representation")
+{
+  STATIC_REQUIRE(std::is_same_v<compressed_series<timestamp>, delta_of_delta_series<timestamp>>);
+  STATIC_REQUIRE(std::is_same_v<compressed_series<altitude>, xor_series<altitude>>);
+}
+
+TEST_CASE("delta_of_delta_series")
+{
+  SECTION("empty")
+  {
+    const delta_of_delta_series<timestamp> s;
+    CHECK(s.empty());
+    CHECK(s.size() == 0);
+    CHECK(s.begin() == s.end());
+  }
+
+  SECTION("round-trips the points of a logger")
+  {
+    const auto points = logger_timestamps(10'000);
+    delta_of_delta_series<timestamp> s;
+    for (const auto& p : points) s.push_back(p);
+
+    REQUIRE(s.size() == points.size());
+    CHECK(s.front() == points.front());
+    CHECK(s.back() == points.back());
+    CHECK(std::vector<timestamp>(s.begin(), s.end()) == points);
+    for (std::size_t i = 0; i < points.size(); i += 97) CHECK(s[i] == points[i]);
+
+    // 1 bit for a regular point and 9 bits for a jittered one instead of 64
+    CHECK(s.bytes() * 8 < points.size() * sizeof(timestamp));
+  }
+
+  SECTION("round-trips any integers")
+  {
+    constexpr auto min = std::numeric_limits<std::int64_t>::min();
+    constexpr auto max = std::numeric_limits<std::int64_t>::max();
+    const std::vector<std::int64_t> ticks = {0, max, min, -1, 1, max, max, min, 63, -64, 64, 255, -256, 2047, -2048, 0};
+    delta_of_delta_series<timestamp, si::millisecond, 5> s;
+    for (auto t : ticks) s.push_back(timestamp(si::time<si::millisecond, std::int64_t>(t)));
+
+    REQUIRE(s.size() == ticks.size());
+    for (std::size_t i = 0; i < ticks.size(); ++i) CHECK(s[i].relative().number() == ticks[i]);
+  }
+
+  SECTION("stores the ticks of a coarser unit")
+  {
+    using precise_timestamp = quantity_point<clock_origin<std::chrono::system_clock>, si::second, double>;
+    delta_of_delta_series<precise_timestamp, si::millisecond> s;
+    s.push_back(precise_timestamp(si::time<si::second>(1.0004)));
+    s.push_back(precise_timestamp(si::time<si::second>(1.2506)));
+
+    CHECK(s[0].relative().number() == 1.0);
+    CHECK(s[1].relative().number() == 1.251);
+  }
+
+  SECTION("rounds the ticks of integral numbers like the floating-point ones")
+  {
+    using microsecond_timestamp = quantity_point<clock_origin<std::chrono::system_clock>, si::microsecond, int>;
+    delta_of_delta_series<microsecond_timestamp, si::millisecond> s;
+    for (int us : {1'000'400, 1'250'600, -1'000'500, 1'000'500})
+      s.push_back(microsecond_timestamp(si::time<si::microsecond, int>(us)));
+
+    CHECK(s[0].relative().number() == 1'000'000);
+    CHECK(s[1].relative().number() == 1'251'000);
+    CHECK(s[2].relative().number() == -1'001'000);
+    CHECK(s[3].relative().number() == 1'001'000);
+  }
+
+  SECTION("clear")
+  {
+    delta_of_delta_series<timestamp> s;
+    for (const auto& p : logger_timestamps(300)) s.push_back(p);
+    s.clear();
+    CHECK(s.empty());
+    s.push_back(timestamp(si::time<si::millisecond, std::int64_t>(42)));
+    CHECK(s[0].relative().number() == 42);
+  }
+}
+
+TEST_CASE("xor_series")
+{
+  SECTION("empty")
+  {
+    const xor_series<altitude> s;
+    CHECK(s.empty());
+    CHECK(s.begin() == s.end());
+  }
+
+  SECTION("round-trips the altitudes of a glider")
+  {
+    const auto points = glider_altitudes(10'000);
+    xor_series<altitude> s;
+    for (const auto& p : points) s.push_back(p);
+
+    REQUIRE(s.size() == points.size());
+    CHECK(s.front() == points.front());
+    CHECK(s.back() == points.back());
+    CHECK(std::vector<altitude>(s.begin(), s.end()) == points);
+    for (std::size_t i = 0; i < points.size(); i += 89) CHECK(s[i] == points[i]);
+    CHECK(s.bytes() < points.size() * sizeof(altitude));
+  }
+
+  SECTION("round-trips special values bit by bit")
+  {
+    using length_point = quantity_point<dynamic_origin<si::dim_length>, si::metre, float>;
+    const std::vector<float> numbers = {0.f, -0.f, 1.f, std::numeric_limits<float>::infinity(),
+                                        std::numeric_limits<float>::denorm_min(), -1e30f, 1.f, 1.f, 0.f};
+    xor_series<length_point, 4> s;
+    for (auto n : numbers) s.push_back(length_point(si::length<si::metre, float>(n)));
+
+    REQUIRE(s.size() == numbers.size());
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+      CHECK(std::bit_cast<std::uint32_t>(s[i].relative().number()) == std::bit_cast<std::uint32_t>(numbers[i]));
+  }
+
+  SECTION("repeated values take a bit")
+  {
+    xor_series<altitude> s;
+    for (int i = 0; i < 6400; ++i) s.push_back(altitude(si::length<si::metre>(1000.)));
+    CHECK(s.bytes() < 6400 / 8 + 50 * (8 + 16));
+  }
+}
@@ -0,0 +1,247 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/bits/constexpr_math.h>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace units::detail;
+
+namespace {
+
+// the number of representable doubles between a and b
+std::uint64_t ulp_distance(double a, double b)
+{
+  const auto ordered = [](double v) {
+    const auto bits = std::bit_cast<std::int64_t>(v);
+    return bits < 0 ? std::numeric_limits<std::int64_t>::min() - bits : bits;
+  };
+  const std::int64_t x = ordered(a);
+  const std::int64_t y = ordered(b);
+  return x < y ? static_cast<std::uint64_t>(y) - static_cast<std::uint64_t>(x)
+               : static_cast<std::uint64_t>(x) - static_cast<std::uint64_t>(y);
+}
+
+// samples spread evenly on the logarithmic scale over (almost) the whole range of double
+std::vector<double> logarithmic_samples()
+{
+  std::vector<double> samples;
+  for (int i = -2000; i <= 2000; ++i) samples.push_back(std::pow(1.4142, i) * 1.2345);
+  return samples;
+}
+
+// samples spread evenly over [-100, 100]
+std::vector<double> linear_samples()
+{
+  std::vector<double> samples;
+  for (int i = -10000; i <= 10000; ++i) samples.push_back(i * 0.01 + 0.0012345);
+  return samples;
+}
+
+// the doubles nearest to k * pi/2 (and their neighbours) where most of the bits cancel in the reduction
+std::vector<double> half_pi_multiples_samples()
+{
+  constexpr long double half_pi = 1.570796326794896619231321691639751442L;
+  std::vector<double> samples;
+  const auto add = [&](long double k) {
+    const auto v = static_cast<double>(k * half_pi);
+    samples.push_back(std::nextafter(v, 0.));
+    samples.push_back(v);
+    samples.push_back(std::nextafter(v, 2 * v));
+  };
+  for (int k = 1; k <= 1000; ++k) add(k);
+  for (long double k = 1000; k <= 1e6L; k *= 1.01L) add(std::floor(k));
+  add(1e6L);
+  return samples;
+}
+
+template<typename F, typename G>
+std::uint64_t max_ulp_distance(const std::vector<double>& samples, F f, G g)
+{
+  std::uint64_t result = 0;
+  for (const double v : samples) result = std::max(result, ulp_distance(f(v), g(v)));
+  return result;
+}
+
+}  // namespace
+
+TEST_CASE("'constexpr_sqrt()' is accurate", "[constexpr_math][sqrt]")
+{
+  const auto samples = logarithmic_samples();
+  CHECK(max_ulp_distance(samples, constexpr_sqrt<double>, [](double v) { return std::sqrt(v); }) <= 1);
+
+  CHECK(constexpr_sqrt(0.) == 0.);
+  CHECK(std::isnan(constexpr_sqrt(-1.)));
+  CHECK(constexpr_sqrt(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity());
+  CHECK(constexpr_sqrt(std::numeric_limits<double>::denorm_min()) == std::sqrt(std::numeric_limits<double>::denorm_min()));
+}
+
+TEST_CASE("'constexpr_cbrt()' is accurate", "[constexpr_math][cbrt]")
+{
+  const auto samples = logarithmic_samples();
+  // some `std::cbrt` implementations (e.g. glibc) are not correctly rounded themselves (up to 3 ULP)
+  CHECK(max_ulp_distance(samples, constexpr_cbrt<double>, [](double v) { return std::cbrt(v); }) <= 4);
+  CHECK(max_ulp_distance(
+          samples, [](double v) { return constexpr_cbrt(-v); }, [](double v) { return std::cbrt(-v); }) <= 4);
+
+  CHECK(constexpr_cbrt(0.) == 0.);
+  CHECK(constexpr_cbrt(-8.) == -2.);
+}
+
+TEST_CASE("trigonometric constexpr functions are accurate", "[constexpr_math][sin][cos][tan]")
+{
+  const auto samples = linear_samples();
+  CHECK(max_ulp_distance(samples, constexpr_sin<double>, [](double v) { return std::sin(v); }) <= 2);
+  CHECK(max_ulp_distance(samples, constexpr_cos<double>, [](double v) { return std::cos(v); }) <= 2);
+  CHECK(max_ulp_distance(samples, constexpr_tan<double>, [](double v) { return std::tan(v); }) <= 4);
+
+  CHECK(constexpr_sin(0.) == 0.);
+  CHECK(constexpr_cos(0.) == 1.);
+  CHECK(std::isnan(constexpr_sin(std::numeric_limits<double>::infinity())));
+}
+
+TEST_CASE("trigonometric constexpr functions are accurate close to the multiples of pi/2",
+          "[constexpr_math][sin][cos][tan]")
+{
+  const auto samples = half_pi_multiples_samples();
+  const auto negated = [](auto f) { return [f](double v) { return f(-v); }; };
+  CHECK(max_ulp_distance(samples, constexpr_sin<double>, [](double v) { return std::sin(v); }) <= 2);
+  CHECK(max_ulp_distance(samples, constexpr_cos<double>, [](double v) { return std::cos(v); }) <= 2);
+  CHECK(max_ulp_distance(samples, constexpr_tan<double>, [](double v) { return std::tan(v); }) <= 4);
+  CHECK(max_ulp_distance(samples, negated(constexpr_sin<double>), negated([](double v) { return std::sin(v); })) <=
+        2);
+  CHECK(max_ulp_distance(samples, negated(constexpr_cos<double>), negated([](double v) { return std::cos(v); })) <=
+        2);
+
+  CHECK(constexpr_sin(3.141592653589793) == std::sin(3.141592653589793));
+}
+
+TEST_CASE("trigonometric constexpr functions are accurate for large arguments", "[constexpr_math][sin][cos][tan]")
+{
+  std::vector<double> samples = logarithmic_samples();
+  std::erase_if(samples, [](double v) { return v < 1e5; });
+  // around the switch from the Cody-Waite to the Payne-Hanek reduction
+  for (double v = 0x1p20 - 16; v < 0x1p20 + 16; v += 0.25) samples.push_back(v);
+  samples.push_back(std::numeric_limits<double>::max());
+  const auto negated = [](auto f) { return [f](double v) { return f(-v); }; };
+
+  CHECK(max_ulp_distance(samples, constexpr_sin<double>, [](double v) { return std::sin(v); }) <= 2);
+  CHECK(max_ulp_distance(samples, constexpr_cos<double>, [](double v) { return std::cos(v); }) <= 2);
+  CHECK(max_ulp_distance(samples, constexpr_tan<double>, [](double v) { return std::tan(v); }) <= 4);
+  CHECK(max_ulp_distance(samples, negated(constexpr_sin<double>), negated([](double v) { return std::sin(v); })) <=
+        2);
+  CHECK(max_ulp_distance(samples, negated(constexpr_cos<double>), negated([](double v) { return std::cos(v); })) <=
+        2);
+
+  // the double closest to a multiple of pi/2 (the reduced argument is about 2^-61)
+  CHECK(constexpr_cos(0x1.6ac5b262ca1ffp+849) == -0x1.14ae72e6ba22fp-61);
+  CHECK(constexpr_sin(0x1.6ac5b262ca1ffp+849) == 1.);
+
+  // the compile-time reduction does not depend on the range of `std::intmax_t`
+  static_assert(constexpr_sin(1e19) > -0.928 && constexpr_sin(1e19) < -0.927);
+  static_assert(constexpr_cos(std::numeric_limits<double>::max()) < -0.99);
+}
+
+TEST_CASE("'constexpr_hypot()' is accurate", "[constexpr_math][hypot]")
+{
+  const auto samples = logarithmic_samples();
+  CHECK(max_ulp_distance(
+          samples, [](double v) { return constexpr_hypot(v, 3 * v + 1); },
+          [](double v) { return std::hypot(v, 3 * v + 1); }) <= 2);
+  CHECK(max_ulp_distance(
+          samples, [](double v) { return constexpr_hypot(v, 1 / v, 2.5); },
+          [](double v) { return std::hypot(v, 1 / v, 2.5); }) <= 2);
+
+  // no undue overflow
+  CHECK(constexpr_hypot(1e300, 1e300) == std::hypot(1e300, 1e300));
+}
+
+TEST_CASE("'constexpr_exp()' is accurate", "[constexpr_math][exp]")
+{
+  const auto samples = linear_samples();
+  CHECK(max_ulp_distance(samples, constexpr_exp<double>, [](double v) { return std::exp(v); }) <= 1);
+  CHECK(max_ulp_distance(
+          samples, [](double v) { return constexpr_exp(7 * v); }, [](double v) { return std::exp(7 * v); }) <= 1);
+
+  CHECK(constexpr_exp(0.) == 1.);
+  CHECK(constexpr_exp(1000.) == std::numeric_limits<double>::infinity());
+  CHECK(constexpr_exp(-1000.) == 0.);
+  CHECK(constexpr_exp(-740.) == std::exp(-740.));  // subnormal result
+}
+
+TEST_CASE("'constexpr_log()' is accurate", "[constexpr_math][log]")
+{
+  const auto samples = logarithmic_samples();
+  CHECK(max_ulp_distance(samples, constexpr_log<double>, [](double v) { return std::log(v); }) <= 1);
+
+  CHECK(constexpr_log(1.) == 0.);
+  CHECK(constexpr_log(0.) == -std::numeric_limits<double>::infinity());
+  CHECK(std::isnan(constexpr_log(-1.)));
+  constexpr double denorm_min = std::numeric_limits<double>::denorm_min();
+  CHECK(constexpr_log(denorm_min) == std::log(denorm_min));
+}
+
+TEST_CASE("'constexpr_pow()' is accurate", "[constexpr_math][pow]")
+{
+  const auto samples = logarithmic_samples();
+  // the accuracy depends on the precision of `long double` used for the intermediate results
+  constexpr std::uint64_t max_ulp = std::numeric_limits<long double>::digits > 53 ? 1 : 1024;
+  for (const double exponent : {-2.5, -1. / 3, 0.2, 0.75, 1.4}) {
+    CAPTURE(exponent);
+    CHECK(max_ulp_distance(
+            samples, [&](double v) { return constexpr_pow(v, exponent); },
+            [&](double v) { return std::pow(v, exponent); }) <= max_ulp);
+  }
+
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  CHECK(std::isnan(constexpr_pow(nan, 2.)));
+  CHECK(std::isnan(constexpr_pow(nan, -2.)));
+  CHECK(std::isnan(constexpr_pow(0., nan)));
+  CHECK(std::isnan(constexpr_pow(2., nan)));
+}
+
+TEST_CASE("'constexpr_exp()' and 'constexpr_log()' are correctly rounded for float", "[constexpr_math][exp][log]")
+{
+  // exhaustive over all the floats of [0.5, 2) for log and of [0.5, 1) (with a range of large magnitudes) for exp
+  const auto max_float_ulp_distance = [](float begin, float end, auto f, auto g) {
+    std::uint32_t result = 0;
+    for (float v = begin; v < end; v = std::nextafter(v, end)) {
+      const auto a = std::bit_cast<std::int32_t>(f(v));
+      const auto b = std::bit_cast<std::int32_t>(g(v));
+      result = std::max(result, static_cast<std::uint32_t>(a < b ? b - a : a - b));
+    }
+    return result;
+  };
+  CHECK(max_float_ulp_distance(0.5f, 2.f, constexpr_log<float>, [](float v) {
+          return static_cast<float>(std::log(static_cast<double>(v)));
+        }) == 0);
+  CHECK(max_float_ulp_distance(0.5f, 1.f, constexpr_exp<float>, [](float v) {
+          return static_cast<float>(std::exp(static_cast<double>(v)));
+        }) == 0);
+  CHECK(max_float_ulp_distance(-80.f, -79.99f, constexpr_exp<float>, [](float v) {
+          return static_cast<float>(std::exp(static_cast<double>(v)));
+        }) == 0);
+}
@@ -24,9 +24,16 @@
 #include <units/isq/si/length.h>
 #include <units/quantity_io.h>
 #include <units/random.h>
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <random>
+#include <thread>
+#include <utility>
 #include <vector>
 
 
@@ -575,6 +582,18 @@ TEST_CASE("piecewise_constant_distribution")
     CHECK(units_dist.intervals() == intervals_qty_vec);
     CHECK(units_dist.densities() == stl_dist.densities());
   }
+
+  SECTION("parametrized_quantity_range")
+  {
+    const std::vector<rep> weights = {1.0, 2.0, 3.0};
+
+    auto stl_dist = std::piecewise_constant_distribution<rep>(intervals_rep_vec.cbegin(), intervals_rep_vec.cend(),
+                                                             weights.cbegin());
+    auto units_dist = units::piecewise_constant_distribution<q>(intervals_qty_vec, weights);
+
+    CHECK(units_dist.intervals() == intervals_qty_vec);
+    CHECK(units_dist.densities() == stl_dist.densities());
+  }
 }
 
 TEST_CASE("piecewise_linear_distribution")
@@ -639,4 +658,494 @@ TEST_CASE("piecewise_linear_distribution")
     CHECK(units_dist.intervals() == intervals_qty_vec);
     CHECK(units_dist.densities() == stl_dist.densities());
   }
+
+  SECTION("parametrized_quantity_range")
+  {
+    const std::vector<rep> weights = {1.0, 2.0, 3.0};
+
+    auto stl_dist = std::piecewise_linear_distribution<rep>(intervals_rep_vec.cbegin(), intervals_rep_vec.cend(),
+                                                             weights.cbegin());
+    auto units_dist = units::piecewise_linear_distribution<q>(intervals_qty_vec, weights);
+
+    CHECK(units_dist.intervals() == intervals_qty_vec);
+    CHECK(units_dist.densities() == stl_dist.densities());
+  }
+}
+
+TEST_CASE("fixed_piecewise_constant_distribution")
+{
+  using rep = double;
+  using q = length<metre, rep>;
+  using dist = units::fixed_piecewise_constant_distribution<q, 4>;
+
+  const std::vector<q> intervals_qty_vec = {1.0_q_m, 2.0_q_m, 3.0_q_m, 5.0_q_m};
+  const std::vector<rep> weights = {1.0, 2.0, 3.0};
+
+  // compares the parameters with the ones of the allocating distribution
+  const auto check_same = [](const dist& fixed_dist, const units::piecewise_constant_distribution<q>& units_dist) {
+    CHECK(std::ranges::equal(fixed_dist.intervals(), units_dist.intervals()));
+    CHECK(std::ranges::equal(fixed_dist.densities(), units_dist.densities()));
+    CHECK(fixed_dist.min() == units_dist.min());
+    CHECK(fixed_dist.max() == units_dist.max());
+  };
+
+  SECTION("default") { check_same(dist(), units::piecewise_constant_distribution<q>()); }
+
+  SECTION("parametrized_input_it")
+  {
+    check_same(dist(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(), weights.cbegin()),
+               units::piecewise_constant_distribution<q>(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(),
+                                                         weights.cbegin()));
+  }
+
+  SECTION("parametrized_quantity_range")
+  {
+    check_same(dist(intervals_qty_vec, weights), units::piecewise_constant_distribution<q>(intervals_qty_vec, weights));
+  }
+
+  SECTION("parametrized_initializer_list")
+  {
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    check_same(dist({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw),
+               units::piecewise_constant_distribution<q>({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw));
+  }
+
+  SECTION("parametrized_range")
+  {
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    check_same(dist(3, 1.0_q_m, 4.0_q_m, fw), units::piecewise_constant_distribution<q>(3, 1.0_q_m, 4.0_q_m, fw));
+  }
+
+  SECTION("re-parametrized in place")
+  {
+    auto fixed_dist = dist(intervals_qty_vec, weights);
+    fixed_dist.assign({0.0_q_m, 1.0_q_m}, [](q) { return 1.0; });
+    check_same(fixed_dist, units::piecewise_constant_distribution<q>());
+    fixed_dist.assign(intervals_qty_vec, weights);
+    check_same(fixed_dist, units::piecewise_constant_distribution<q>(intervals_qty_vec, weights));
+  }
+
+  SECTION("samples")
+  {
+    auto fixed_dist = dist(intervals_qty_vec, weights);
+    std::mt19937_64 gen(42);
+    std::vector<q> samples(600'000);
+    fixed_dist.generate(gen, samples);
+
+    // the probabilities of the intervals are proportional to the weights
+    const auto in = [&](q a, q b) {
+      return static_cast<double>(std::ranges::count_if(samples, [&](q v) { return a <= v && v < b; })) / 600'000;
+    };
+    CHECK(std::abs(in(1.0_q_m, 2.0_q_m) - 1.0 / 6) < 0.005);
+    CHECK(std::abs(in(2.0_q_m, 3.0_q_m) - 2.0 / 6) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 5.0_q_m) - 3.0 / 6) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 4.0_q_m) - 1.5 / 6) < 0.005);
+  }
+}
+
+TEST_CASE("fixed_piecewise_linear_distribution")
+{
+  using rep = double;
+  using q = length<metre, rep>;
+  using dist = units::fixed_piecewise_linear_distribution<q, 4>;
+
+  const std::vector<q> intervals_qty_vec = {1.0_q_m, 2.0_q_m, 3.0_q_m, 5.0_q_m};
+  const std::vector<rep> weights = {1.0, 2.0, 0.0, 3.0};
+
+  // compares the parameters with the ones of the allocating distribution
+  const auto check_same = [](const dist& fixed_dist, const units::piecewise_linear_distribution<q>& units_dist) {
+    CHECK(std::ranges::equal(fixed_dist.intervals(), units_dist.intervals()));
+    CHECK(std::ranges::equal(fixed_dist.densities(), units_dist.densities()));
+    CHECK(fixed_dist.min() == units_dist.min());
+    CHECK(fixed_dist.max() == units_dist.max());
+  };
+
+  SECTION("default") { check_same(dist(), units::piecewise_linear_distribution<q>()); }
+
+  SECTION("parametrized_input_it")
+  {
+    check_same(dist(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(), weights.cbegin()),
+               units::piecewise_linear_distribution<q>(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(),
+                                                       weights.cbegin()));
+  }
+
+  SECTION("parametrized_quantity_range")
+  {
+    check_same(dist(intervals_qty_vec, weights), units::piecewise_linear_distribution<q>(intervals_qty_vec, weights));
+  }
+
+  SECTION("parametrized_initializer_list")
+  {
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    check_same(dist({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw),
+               units::piecewise_linear_distribution<q>({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw));
+  }
+
+  SECTION("parametrized_range")
+  {
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    // the weights at the boundaries as specified by the standard (libstdc++ evaluates them one interval further)
+    const std::vector<q> intervals = {1.0_q_m, 2.0_q_m, 3.0_q_m, 4.0_q_m};
+    const std::vector<rep> weights_at_bounds = {1.0, 4.0, 9.0, 16.0};
+    check_same(dist(3, 1.0_q_m, 4.0_q_m, fw), units::piecewise_linear_distribution<q>(intervals, weights_at_bounds));
+  }
+
+  SECTION("re-parametrized in place")
+  {
+    auto fixed_dist = dist(intervals_qty_vec, weights);
+    fixed_dist.assign({0.0_q_m, 1.0_q_m}, [](q) { return 1.0; });
+    check_same(fixed_dist, units::piecewise_linear_distribution<q>());
+    fixed_dist.assign(intervals_qty_vec, weights);
+    check_same(fixed_dist, units::piecewise_linear_distribution<q>(intervals_qty_vec, weights));
+  }
+
+  SECTION("samples")
+  {
+    auto fixed_dist = dist(intervals_qty_vec, weights);
+    std::mt19937_64 gen(42);
+    std::vector<q> samples(600'000);
+    fixed_dist.generate(gen, samples);
+
+    // the areas under the density (1.5, 1, and 3 of the total 5.5 in the intervals and 0.75 in [3, 4))
+    const auto in = [&](q a, q b) {
+      return static_cast<double>(std::ranges::count_if(samples, [&](q v) { return a <= v && v < b; })) / 600'000;
+    };
+    CHECK(std::abs(in(1.0_q_m, 2.0_q_m) - 1.5 / 5.5) < 0.005);
+    CHECK(std::abs(in(2.0_q_m, 3.0_q_m) - 1.0 / 5.5) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 5.0_q_m) - 3.0 / 5.5) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 4.0_q_m) - 0.75 / 5.5) < 0.005);
+  }
+}
+
+TEST_CASE("alias_discrete_distribution")
+{
+  using rep = std::int64_t;
+  using q = length<metre, rep>;
+
+  SECTION("default")
+  {
+    auto units_dist = units::discrete_distribution<q>();
+    auto alias_dist = units::alias_discrete_distribution<q>();
+
+    CHECK(alias_dist.probabilities() == units_dist.probabilities());
+    CHECK(alias_dist.min() == units_dist.min());
+    CHECK(alias_dist.max() == units_dist.max());
+  }
+
+  SECTION("parametrized_input_it")
+  {
+    constexpr std::array<double, 3> weights = {1.0, 2.0, 3.0};
+
+    auto units_dist = units::discrete_distribution<q>(weights.cbegin(), weights.cend());
+    auto alias_dist = units::alias_discrete_distribution<q>(weights.cbegin(), weights.cend());
+
+    CHECK(alias_dist.probabilities() == units_dist.probabilities());
+    CHECK(alias_dist.max() == units_dist.max());
+  }
+
+  SECTION("parametrized_initializer_list")
+  {
+    auto units_dist = units::discrete_distribution<q>({1.0, 2.0, 3.0});
+    auto alias_dist = units::alias_discrete_distribution<q>({1.0, 2.0, 3.0});
+
+    CHECK(alias_dist.probabilities() == units_dist.probabilities());
+  }
+
+  SECTION("parametrized_range")
+  {
+    auto units_dist = units::discrete_distribution<q>(3, 1.0, 6.0, [](double val) { return val * val; });
+    auto alias_dist = units::alias_discrete_distribution<q>(3, 1.0, 6.0, [](double val) { return val * val; });
+
+    CHECK(alias_dist.probabilities() == units_dist.probabilities());
+  }
+
+  SECTION("samples")
+  {
+    // the chi-squared statistic of the counts of many bins of different probabilities (including empty ones)
+    constexpr std::size_t bins = 1000;
+    constexpr std::size_t count = 2'000'000;
+    std::vector<double> weights(bins);
+    for (std::size_t i = 0; i < bins; ++i) weights[i] = i % 10 == 0 ? 0.0 : static_cast<double>(i % 37 + 1);
+    const auto alias_dist = units::alias_discrete_distribution<q>(weights);
+
+    std::mt19937_64 gen(42);
+    std::vector<std::size_t> counts(bins);
+    for (std::size_t i = 0; i < count; ++i) ++counts[static_cast<std::size_t>(alias_dist(gen).number())];
+
+    double chi2 = 0;
+    std::size_t dof = 0;
+    for (std::size_t i = 0; i < bins; ++i) {
+      const double expected = alias_dist.probabilities()[i] * count;
+      if (expected == 0) {
+        CHECK(counts[i] == 0);
+        continue;
+      }
+      chi2 += (static_cast<double>(counts[i]) - expected) * (static_cast<double>(counts[i]) - expected) / expected;
+      ++dof;
+    }
+    CHECK(chi2 < static_cast<double>(dof) + 5 * std::sqrt(2.0 * static_cast<double>(dof)));
+  }
+
+  SECTION("shared by threads")
+  {
+    const auto alias_dist = units::alias_discrete_distribution<q>({1.0, 2.0, 3.0});
+    std::array<std::vector<q>, 2> samples;
+    const auto sample = [&](std::size_t t) {
+      philox4x32_10 gen = philox4x32_10(42).split(t);
+      samples[t].resize(1000);
+      alias_dist.generate(gen, samples[t]);
+    };
+    std::thread t0(sample, 0);
+    std::thread t1(sample, 1);
+    t0.join();
+    t1.join();
+
+    philox4x32_10 gen = philox4x32_10(42).split(1);
+    for (const q& v : samples[1]) CHECK(v == alias_dist(gen));
+  }
+}
+
+TEST_CASE("alias_piecewise_constant_distribution")
+{
+  using rep = double;
+  using q = length<metre, rep>;
+
+  const std::vector<q> intervals_qty_vec = {1.0_q_m, 2.0_q_m, 3.0_q_m, 5.0_q_m};
+  const std::vector<rep> weights = {1.0, 2.0, 3.0};
+
+  // compares the parameters with the ones of the distribution using a binary search
+  const auto check_same = [](const units::alias_piecewise_constant_distribution<q>& alias_dist,
+                             const units::piecewise_constant_distribution<q>& units_dist) {
+    CHECK(alias_dist.intervals() == units_dist.intervals());
+    CHECK(alias_dist.densities() == units_dist.densities());
+    CHECK(alias_dist.min() == units_dist.min());
+    CHECK(alias_dist.max() == units_dist.max());
+  };
+
+  SECTION("default")
+  {
+    check_same(units::alias_piecewise_constant_distribution<q>(), units::piecewise_constant_distribution<q>());
+  }
+
+  SECTION("parametrized_input_it")
+  {
+    check_same(units::alias_piecewise_constant_distribution<q>(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(),
+                                                               weights.cbegin()),
+               units::piecewise_constant_distribution<q>(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(),
+                                                         weights.cbegin()));
+  }
+
+  SECTION("parametrized_quantity_range")
+  {
+    check_same(units::alias_piecewise_constant_distribution<q>(intervals_qty_vec, weights),
+               units::piecewise_constant_distribution<q>(intervals_qty_vec, weights));
+  }
+
+  SECTION("parametrized_initializer_list")
+  {
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    check_same(units::alias_piecewise_constant_distribution<q>({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw),
+               units::piecewise_constant_distribution<q>({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw));
+  }
+
+  SECTION("parametrized_range")
+  {
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    check_same(units::alias_piecewise_constant_distribution<q>(3, 1.0_q_m, 4.0_q_m, fw),
+               units::piecewise_constant_distribution<q>(3, 1.0_q_m, 4.0_q_m, fw));
+  }
+
+  SECTION("samples")
+  {
+    const auto alias_dist = units::alias_piecewise_constant_distribution<q>(intervals_qty_vec, weights);
+    std::mt19937_64 gen(42);
+    std::vector<q> samples(600'000);
+    alias_dist.generate(gen, samples);
+
+    // the probabilities of the intervals are proportional to the weights
+    const auto in = [&](q a, q b) {
+      return static_cast<double>(std::ranges::count_if(samples, [&](q v) { return a <= v && v < b; })) / 600'000;
+    };
+    CHECK(std::abs(in(1.0_q_m, 2.0_q_m) - 1.0 / 6) < 0.005);
+    CHECK(std::abs(in(2.0_q_m, 3.0_q_m) - 2.0 / 6) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 5.0_q_m) - 3.0 / 6) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 4.0_q_m) - 1.5 / 6) < 0.005);
+  }
+}
+
+TEST_CASE("alias_piecewise_linear_distribution")
+{
+  using rep = double;
+  using q = length<metre, rep>;
+
+  const std::vector<q> intervals_qty_vec = {1.0_q_m, 2.0_q_m, 3.0_q_m, 5.0_q_m};
+  const std::vector<rep> weights = {1.0, 2.0, 0.0, 3.0};
+
+  // compares the parameters with the ones of the distribution using a binary search
+  const auto check_same = [](const units::alias_piecewise_linear_distribution<q>& alias_dist,
+                             const units::piecewise_linear_distribution<q>& units_dist) {
+    CHECK(alias_dist.intervals() == units_dist.intervals());
+    CHECK(alias_dist.densities() == units_dist.densities());
+    CHECK(alias_dist.min() == units_dist.min());
+    CHECK(alias_dist.max() == units_dist.max());
+  };
+
+  SECTION("default")
+  {
+    check_same(units::alias_piecewise_linear_distribution<q>(), units::piecewise_linear_distribution<q>());
+  }
+
+  SECTION("parametrized_input_it")
+  {
+    check_same(units::alias_piecewise_linear_distribution<q>(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(),
+                                                             weights.cbegin()),
+               units::piecewise_linear_distribution<q>(intervals_qty_vec.cbegin(), intervals_qty_vec.cend(),
+                                                       weights.cbegin()));
+  }
+
+  SECTION("parametrized_quantity_range")
+  {
+    check_same(units::alias_piecewise_linear_distribution<q>(intervals_qty_vec, weights),
+               units::piecewise_linear_distribution<q>(intervals_qty_vec, weights));
+  }
+
+  SECTION("parametrized_initializer_list")
+  {
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    check_same(units::alias_piecewise_linear_distribution<q>({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw),
+               units::piecewise_linear_distribution<q>({1.0_q_m, 2.0_q_m, 3.0_q_m}, fw));
+  }
+
+  SECTION("parametrized_range")
+  {
+    // the weights at the boundaries as specified by the standard (libstdc++ evaluates them one interval further)
+    const auto fw = [](q qty) { return qty.number() * qty.number(); };
+    const std::vector<q> intervals = {1.0_q_m, 2.0_q_m, 3.0_q_m, 4.0_q_m};
+    const std::vector<rep> weights_at_bounds = {1.0, 4.0, 9.0, 16.0};
+    check_same(units::alias_piecewise_linear_distribution<q>(3, 1.0_q_m, 4.0_q_m, fw),
+               units::piecewise_linear_distribution<q>(intervals, weights_at_bounds));
+  }
+
+  SECTION("samples")
+  {
+    const auto alias_dist = units::alias_piecewise_linear_distribution<q>(intervals_qty_vec, weights);
+    std::mt19937_64 gen(42);
+    std::vector<q> samples(600'000);
+    alias_dist.generate(gen, samples);
+
+    // the areas under the density (1.5, 1, and 3 of the total 5.5 in the intervals and 0.75 in [3, 4))
+    const auto in = [&](q a, q b) {
+      return static_cast<double>(std::ranges::count_if(samples, [&](q v) { return a <= v && v < b; })) / 600'000;
+    };
+    CHECK(std::abs(in(1.0_q_m, 2.0_q_m) - 1.5 / 5.5) < 0.005);
+    CHECK(std::abs(in(2.0_q_m, 3.0_q_m) - 1.0 / 5.5) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 5.0_q_m) - 3.0 / 5.5) < 0.005);
+    CHECK(std::abs(in(3.0_q_m, 4.0_q_m) - 0.75 / 5.5) < 0.005);
+  }
+}
+
+TEST_CASE("bulk generation")
+{
+  using q = length<metre>;
+
+  // the mean and the variance of the generated numbers
+  const auto moments = [](const std::vector<q>& samples) {
+    double sum = 0, sum_sq = 0;
+    for (const q& v : samples) {
+      sum += v.number();
+      sum_sq += v.number() * v.number();
+    }
+    const double mean = sum / static_cast<double>(samples.size());
+    return std::pair{mean, sum_sq / static_cast<double>(samples.size()) - mean * mean};
+  };
+
+  std::mt19937_64 gen(42);
+  std::vector<q> samples(1'000'000);
+
+  SECTION("generic distributions produce the same numbers as 'operator()'")
+  {
+    auto units_dist = units::poisson_distribution<length<metre, std::int64_t>>(4.0);
+    std::vector<length<metre, std::int64_t>> bulk(1000);
+    units_dist.generate(gen, bulk);
+
+    gen.seed(42);
+    units_dist.reset();
+    for (const auto& v : bulk) CHECK(v == units_dist(gen));
+  }
+
+  SECTION("uniform_real_distribution")
+  {
+    auto units_dist = units::uniform_real_distribution<q>(2.0_q_m, 5.0_q_m);
+    units_dist.generate(gen, samples);
+
+    const auto [mean, variance] = moments(samples);
+    CHECK(std::abs(mean - 3.5) < 0.01);
+    CHECK(std::abs(variance - 0.75) < 0.01);
+    CHECK(std::ranges::all_of(samples, [](const q& v) { return v >= 2.0_q_m && v < 5.0_q_m; }));
+  }
+
+  SECTION("uniform_real_distribution never returns the upper bound")
+  {
+    // all the bits set give the largest canonical number `1 - 2^-53` for which `1 + (2 - 1) * u` rounds to `2`
+    struct max_bits_engine {
+      using result_type = std::uint64_t;
+      static constexpr result_type min() { return 0; }
+      static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+      result_type operator()() { return max(); }
+    };
+    max_bits_engine max_gen;
+
+    auto units_dist = units::uniform_real_distribution<q>(1.0_q_m, 2.0_q_m);
+    std::vector<q> values(4);
+    units_dist.generate(max_gen, values);
+    CHECK(std::ranges::all_of(values, [](const q& v) { return v >= 1.0_q_m && v < 2.0_q_m; }));
+  }
+
+  SECTION("exponential_distribution")
+  {
+    auto units_dist = units::exponential_distribution<q>(0.5);
+    units_dist.generate(gen, samples);
+
+    const auto [mean, variance] = moments(samples);
+    CHECK(std::abs(mean - 2.0) < 0.01);
+    CHECK(std::abs(variance - 4.0) < 0.05);
+    CHECK(std::ranges::all_of(samples, [](const q& v) { return v >= 0.0_q_m; }));
+
+    // the fraction in the tail of the Ziggurat (exp(-8) for the standard exponential distribution)
+    const auto tail = std::ranges::count_if(samples, [](const q& v) { return v > 16.0_q_m; });
+    CHECK(std::abs(static_cast<double>(tail) / 1e6 - 3.355e-4) < 6e-5);
+  }
+
+  SECTION("normal_distribution")
+  {
+    auto units_dist = units::normal_distribution<q>(5.0_q_m, 2.0_q_m);
+    units_dist.generate(gen, samples);
+
+    const auto [mean, variance] = moments(samples);
+    CHECK(std::abs(mean - 5.0) < 0.01);
+    CHECK(std::abs(variance - 4.0) < 0.02);
+
+    // the fractions within 1, 2, and 3 standard deviations and beyond 4 (in the tail of the Ziggurat)
+    std::array<std::size_t, 4> counts{};
+    for (const q& v : samples) {
+      const double x = std::abs(v.number() - 5.0) / 2.0;
+      counts[0] += x < 1;
+      counts[1] += x < 2;
+      counts[2] += x < 3;
+      counts[3] += x > 4;
+    }
+    const auto fraction = [&](std::size_t count) { return static_cast<double>(count) / 1e6; };
+    CHECK(std::abs(fraction(counts[0]) - 0.682689) < 0.002);
+    CHECK(std::abs(fraction(counts[1]) - 0.954500) < 0.001);
+    CHECK(std::abs(fraction(counts[2]) - 0.997300) < 0.0002);
+    CHECK(std::abs(fraction(counts[3]) - 6.334e-5) < 3e-5);
+  }
+
+  SECTION("generate_n")
+  {
+    auto units_dist = units::normal_distribution<q>(5.0_q_m, 2.0_q_m);
+    std::vector<q> values;
+    units_dist.generate_n(gen, std::back_inserter(values), 10);
+    CHECK(values.size() == 10);
+  }
 }
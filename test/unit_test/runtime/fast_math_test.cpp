@@ -0,0 +1,237 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/fast_math.h>
+#include <units/isq/si/length.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+// radians in one unit
+template<typename U>
+long double scale()
+{
+  return get_value<long double>(U::mag);
+}
+
+// the reference angle in radians (reduced exactly by full turns for the units with a rational full turn)
+template<typename U, typename T>
+long double reference_radians(T v)
+{
+  if constexpr (std::is_same_v<U, radian>) {
+    return static_cast<long double>(v);
+  } else {
+    const long double full_turn = std::round(2 * std::numbers::pi_v<long double> / scale<U>());
+    return std::fmod(static_cast<long double>(v), full_turn) * scale<U>();
+  }
+}
+
+// angles spread evenly over [-100, 100] revolutions
+template<typename U, typename T>
+std::vector<T> samples()
+{
+  const long double full_turn = 2 * std::numbers::pi_v<long double> / scale<U>();
+  std::vector<T> res;
+  for (int i = -100'000; i <= 100'000; ++i) res.push_back(static_cast<T>(i * full_turn / 1000 + full_turn / 12345));
+  return res;
+}
+
+// the maximum errors documented in `units/fast_math.h`
+template<typename T>
+struct max_error;
+
+template<>
+struct max_error<float> {
+  static constexpr long double sin_cos = 1.1e-7L;
+  static constexpr long double tan = 2.7e-7L;
+  static constexpr long double atan2_ulp = 3.5L;
+};
+
+template<>
+struct max_error<double> {
+  static constexpr long double sin_cos = 1.7e-16L;
+  static constexpr long double tan = 1.2e-15L;
+  static constexpr long double atan2_ulp = 2.7L;
+};
+
+template<typename U, typename T>
+void check_trig()
+{
+  long double sin_error = 0;
+  long double cos_error = 0;
+  long double tan_error = 0;
+  for (const T v : samples<U, T>()) {
+    const long double r = reference_radians<U>(v);
+    const angle<U, T> a(v);
+    sin_error = std::max(sin_error, std::abs(fast::sin(a).number() - std::sin(r)));
+    cos_error = std::max(cos_error, std::abs(fast::cos(a).number() - std::cos(r)));
+    const long double t = std::tan(r);
+    if (std::abs(t) <= 100)
+      tan_error = std::max(tan_error, std::abs(fast::tan(a).number() - t) / std::max(1.L, std::abs(t)));
+  }
+  CHECK(sin_error <= max_error<T>::sin_cos);
+  CHECK(cos_error <= max_error<T>::sin_cos);
+  CHECK(tan_error <= max_error<T>::tan);
+}
+
+// the valid ranges of the argument reduction documented in `units/fast_math.h`
+template<typename U, typename T>
+long double max_turns()
+{
+  constexpr bool is_float = std::is_same_v<T, float>;
+  if constexpr (std::is_same_v<U, radian>)
+    return is_float ? 0x1p11L : 0x1p26L;
+  else if constexpr (std::is_same_v<U, degree>)
+    return is_float ? 0x1p16L : 0x1p45L;
+  else if constexpr (std::is_same_v<U, gradian>)
+    return is_float ? 0x1p17L : 0x1p46L;
+  else
+    return is_float ? 0x1p20L : 0x1p49L;
+}
+
+// sin and cos of the angles from 100 revolutions up to the limit of the argument reduction
+template<typename U, typename T>
+void check_large_angles()
+{
+  const long double full_turn = 2 * std::numbers::pi_v<long double> / scale<U>();
+  const long double limit = max_turns<U, T>();
+  for (long double turns = 100; turns < limit; turns *= 2) {
+    long double error = 0;
+    for (int i = 0; i < 1000; ++i) {
+      const long double t = std::min(turns * (1 + i / 1000.L), limit * (1 - 0x1p-10L));
+      for (const T v : {static_cast<T>(t * full_turn + i * full_turn / 997), static_cast<T>(-t * full_turn)}) {
+        const long double r = reference_radians<U>(v);
+        const angle<U, T> a(v);
+        error = std::max(error, std::abs(fast::sin(a).number() - std::sin(r)));
+        error = std::max(error, std::abs(fast::cos(a).number() - std::cos(r)));
+      }
+    }
+    // the reduction error of the units with an irrational quarter turn grows by about 1e-19 per turn
+    CHECK(error <= max_error<T>::sin_cos + 1.1e-19L * 2 * turns);
+  }
+}
+
+template<typename U, typename T>
+void check_atan2()
+{
+  long double error = 0;
+  for (int i = -500; i <= 500; ++i) {
+    for (int j = -500; j <= 500; ++j) {
+      const auto y = static_cast<T>(i * 0.0123L);
+      const auto x = static_cast<T>(j * 0.0321L);
+      const long double expected = std::atan2(static_cast<long double>(y), static_cast<long double>(x)) / scale<U>();
+      const auto e = static_cast<T>(expected);
+      const long double ulp = std::nextafter(std::abs(e), std::numeric_limits<T>::infinity()) - std::abs(e);
+      const T res = fast::atan2<U>(length<metre, T>(y), length<metre, T>(x)).number();
+      error = std::max(error, std::abs(res - expected) / ulp);
+    }
+  }
+  CHECK(error <= max_error<T>::atan2_ulp);
+}
+
+}  // namespace
+
+TEST_CASE("fast trigonometric functions are within the documented error", "[math][fast]")
+{
+  SECTION("float")
+  {
+    check_trig<radian, float>();
+    check_trig<degree, float>();
+    check_trig<revolution, float>();
+    check_trig<gradian, float>();
+  }
+  SECTION("double")
+  {
+    check_trig<radian, double>();
+    check_trig<degree, double>();
+    check_trig<revolution, double>();
+    check_trig<gradian, double>();
+  }
+}
+
+TEST_CASE("fast sine and cosine are accurate up to the limit of the argument reduction", "[math][fast]")
+{
+  SECTION("float")
+  {
+    check_large_angles<radian, float>();
+    check_large_angles<degree, float>();
+    check_large_angles<revolution, float>();
+    check_large_angles<gradian, float>();
+  }
+  SECTION("double")
+  {
+    check_large_angles<radian, double>();
+    check_large_angles<degree, double>();
+    check_large_angles<revolution, double>();
+    check_large_angles<gradian, double>();
+  }
+}
+
+TEST_CASE("fast atan2 is within the documented error", "[math][fast]")
+{
+  SECTION("float")
+  {
+    check_atan2<radian, float>();
+    check_atan2<degree, float>();
+    check_atan2<revolution, float>();
+  }
+  SECTION("double")
+  {
+    check_atan2<radian, double>();
+    check_atan2<degree, double>();
+    check_atan2<revolution, double>();
+  }
+}
+
+TEST_CASE("fast trigonometric functions of the units with a rational quarter turn are exact at the quadrants",
+          "[math][fast]")
+{
+  using namespace units::angle_references;
+
+  STATIC_REQUIRE(fast::sin(90. * deg).number() == 1);
+  STATIC_REQUIRE(fast::sin(-180. * deg).number() == 0);
+  STATIC_REQUIRE(fast::cos(0.5 * rev).number() == -1);
+  STATIC_REQUIRE(fast::cos(300. * grad).number() == 0);
+  STATIC_REQUIRE(fast::tan(180. * deg).number() == 0);
+  STATIC_REQUIRE(fast::sin(1e6 * rev).number() == 0);
+  // close to the limit of the argument reduction of `float` (2^20 turns)
+  STATIC_REQUIRE(fast::sin(angle<revolution, float>(0x1p19f + 0.25f)).number() == 1);
+}
+
+TEST_CASE("fast atan2 returns the angle in the requested unit", "[math][fast]")
+{
+  using namespace units::isq::si::references;
+
+  STATIC_REQUIRE(fast::atan2<degree>(1. * m, 1. * m) == angle<degree>(45));
+  STATIC_REQUIRE(fast::atan2<degree>(1. * m, -1. * m) == angle<degree>(135));
+  STATIC_REQUIRE(fast::atan2<degree>(-1. * m, -1. * m) == angle<degree>(-135));
+  STATIC_REQUIRE(fast::atan2<revolution>(0. * m, -1. * m) == angle<revolution>(0.5));
+  STATIC_REQUIRE(fast::atan2<degree>(0. * m, 0. * m) == angle<degree>(0));
+  CHECK(std::abs(fast::atan2(1. * km, 1000. * m).number() - std::numbers::pi / 4) <= 1e-16);
+}
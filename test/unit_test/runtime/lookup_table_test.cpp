@@ -0,0 +1,86 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <units/lookup_table.h>
+#include <cmath>
+
+using namespace units;
+using namespace units::isq::si;
+using namespace units::isq::si::references;
+
+namespace {
+
+// a glider polar (sink rate as a function of the airspeed)
+constexpr speed<metre_per_second> polar(const speed<kilometre_per_hour>& v)
+{
+  const double x = v.number();
+  return speed<metre_per_second>(-0.0000551 * x * x + 0.0108 * x - 1.22);
+}
+
+constexpr lookup_table<speed<kilometre_per_hour>, speed<metre_per_second>, 19> linear_polar(
+  polar, speed<kilometre_per_hour>(70), speed<kilometre_per_hour>(250));
+constexpr lookup_table<speed<kilometre_per_hour>, speed<metre_per_second>, 19, interpolation::cubic> cubic_polar(
+  polar, speed<kilometre_per_hour>(70), speed<kilometre_per_hour>(250));
+
+}  // namespace
+
+TEST_CASE("'lookup_table' is sampled at compile time", "[lookup_table]")
+{
+  STATIC_REQUIRE(linear_polar.values().size() == 19);
+  STATIC_REQUIRE(linear_polar.values()[0] == polar(speed<kilometre_per_hour>(70)).number());
+  STATIC_REQUIRE(linear_polar.values()[18] == polar(speed<kilometre_per_hour>(250)).number());
+  STATIC_REQUIRE(linear_polar.first() == speed<kilometre_per_hour>(70));
+  STATIC_REQUIRE(linear_polar.last() == speed<kilometre_per_hour>(250));
+  STATIC_REQUIRE(linear_polar(speed<kilometre_per_hour>(80)) == polar(speed<kilometre_per_hour>(80)));
+}
+
+TEST_CASE("'lookup_table' interpolates between the samples", "[lookup_table]")
+{
+  for (int i = 0; i <= 180; ++i) {
+    const auto v = speed<kilometre_per_hour>(70. + i);
+    const double expected = polar(v).number();
+    CAPTURE(v.number());
+    // the error of the linear interpolation is at most max|f''| * step^2 / 8 (f'' = 2 * 0.0000551 here)
+    CHECK(std::abs(linear_polar(v).number() - expected) <= 2 * 0.0000551 * 10 * 10 / 8 + 1e-12);
+    // Catmull-Rom splines reproduce quadratic functions away from the ends of the interval
+    if (i >= 10 && i <= 170) CHECK(std::abs(cubic_polar(v).number() - expected) <= 1e-12);
+  }
+}
+
+TEST_CASE("'lookup_table' converts the unit of the argument", "[lookup_table]")
+{
+  CHECK(std::abs(linear_polar(25. * (m / s)).number() - linear_polar(speed<kilometre_per_hour>(90)).number()) <= 1e-15);
+  CHECK(std::abs(cubic_polar(2.5 * (km / min)).number() - polar(speed<kilometre_per_hour>(150)).number()) <= 1e-12);
+}
+
+TEST_CASE("'lookup_table' clamps the arguments to the interval", "[lookup_table]")
+{
+  CHECK(linear_polar(speed<kilometre_per_hour>(10)) == polar(speed<kilometre_per_hour>(70)));
+  CHECK(linear_polar(speed<kilometre_per_hour>(300)) == polar(speed<kilometre_per_hour>(250)));
+  CHECK(cubic_polar(speed<kilometre_per_hour>(-1e300)) == polar(speed<kilometre_per_hour>(70)));
+  const double last = polar(speed<kilometre_per_hour>(250)).number();
+  CHECK(std::abs(cubic_polar(speed<kilometre_per_hour>(1e300)).number() - last) <= 1e-15);
+}
@@ -23,6 +23,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <units/magnitude.h>
 #include <units/ratio.h>
+#include <limits>
 #include <type_traits>
 
 using namespace units;
@@ -213,6 +214,22 @@ TEST_CASE("magnitude converts to numerical value")
     }
   }
 
+  SECTION("Rational powers compute correct values at compile time")
+  {
+    constexpr auto relative_error = [](long double value, long double expected) {
+      return (value > expected ? value - expected : expected - value) / expected;
+    };
+    constexpr long double eps = std::numeric_limits<long double>::epsilon();
+
+    check_same_type_and_value(get_value<double>(pow<ratio{1, 2}>(mag<2>())), 1.4142135623730951);
+    check_same_type_and_value(get_value<float>(pow<ratio{1, 2}>(mag<2>())), 1.41421356f);
+    CHECK(relative_error(get_value<long double>(pow<ratio{1, 3}>(mag<2>())), 1.2599210498948731648L) <= eps);
+    CHECK(relative_error(get_value<long double>(pow<ratio{2, 3}>(mag<10>())), 4.6415888336127788924L) <= eps);
+    CHECK(relative_error(get_value<long double>(pow<ratio{7, 2}>(mag<3>())), 46.765371804359686925L) <= 2 * eps);
+    CHECK(relative_error(get_value<long double>(pow<ratio{-1, 2}>(mag<1000>())), 0.031622776601683793320L) <= 2 * eps);
+    CHECK(relative_error(get_value<long double>(pow<ratio{1, 2}>(mag_pi)), 1.7724538509055160273L) <= eps);
+  }
+
   SECTION("Impossible requests are prevented at compile time")
   {
     // Naturally, we cannot actually write a test to verify a compiler error.  But any of these can
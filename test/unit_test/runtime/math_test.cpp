@@ -29,7 +29,10 @@
 #include <units/isq/si/volume.h>
 #include <units/math.h>
 #include <units/quantity_io.h>
+#include <array>
+#include <cmath>
 #include <limits>
+#include <span>
 
 using namespace units;
 using namespace units::isq;
@@ -46,6 +49,11 @@ TEST_CASE("'pow<N>()' on quantity changes the value and the dimension accordingl
   SECTION("'pow<2>(q)' squares both the value and a dimension") { CHECK(pow<2>(2_q_m) == 4_q_m2); }
 
   SECTION("'pow<3>(q)' cubes both the value and a dimension") { CHECK(pow<3>(2_q_m) == 8_q_m3); }
+
+  SECTION("'pow<-2>(q)' squares the inverse of both the value and a dimension")
+  {
+    CHECK(pow<-2>(2._q_m) * 4._q_m2 == 1);
+  }
 }
 
 TEST_CASE("'sqrt()' on quantity changes the value and the dimension accordingly", "[math][sqrt]")
@@ -61,6 +69,26 @@ TEST_CASE("'cbrt()' on quantity changes the value and the dimension accordingly"
 TEST_CASE("'pow<Num, Den>()' on quantity changes the value and the dimension accordingly", "[math][pow]")
 {
   REQUIRE(pow<1, 4>(16_q_m2) == sqrt(4_q_m));
+  REQUIRE(pow<3, 2>(4._q_m2) == 8._q_m3);
+  REQUIRE(pow<2, 3>(8._q_m3) == 4._q_m2);
+}
+
+TEST_CASE("'pow<Num, Den>()' on quantity does not overflow nor underflow for representable results", "[math][pow]")
+{
+  // `sqrt` and `cbrt` are accurate to 1 ULP
+  const auto near = [](double result, double expected) {
+    return std::abs(result - expected) <= 4 * std::numeric_limits<double>::epsilon() * expected;
+  };
+
+  SECTION("'pow<3, 2>(q)' of a large number")
+  {
+    REQUIRE(near(pow<3, 2>(si::length<si::metre, double>(std::ldexp(1., 600))).number(), std::ldexp(1., 900)));
+  }
+
+  SECTION("'pow<2, 3>(q)' of a small number")
+  {
+    REQUIRE(near(pow<2, 3>(si::length<si::metre, double>(std::ldexp(1., -600))).number(), std::ldexp(1., -400)));
+  }
 }
 
 TEST_CASE("absolute functions on quantity returns the absolute value", "[math][abs][fabs]")
@@ -384,3 +412,186 @@ TEST_CASE("inverse trigonometric functions", "[inv trig]")
     REQUIRE_THAT(atan(quantity{1.}), AlmostEquals(deg<>(45.)));
   }
 }
+
+TEST_CASE("'norm()' computes the Euclidean norm of quantities", "[math][norm]")
+{
+  using namespace units::aliases::isq::si;
+
+  SECTION("same as 'hypot()'")
+  {
+    REQUIRE(norm(m<>(3.), m<>(4.)) == hypot(m<>(3.), m<>(4.)));
+    REQUIRE_THAT(norm(m<>(1.), km<>(2.), cm<>(3.)), AlmostEquals(hypot(m<>(1.), km<>(2.), cm<>(3.))));
+  }
+
+  SECTION("many arguments")
+  {
+    REQUIRE(norm(m<>(1.), m<>(1.), m<>(1.), m<>(1.), m<>(1.), m<>(1.), m<>(1.), m<>(1.), m<>(1.)) == m<>(3.));
+  }
+
+  SECTION("no overflow or underflow")
+  {
+    REQUIRE_THAT(norm(m<>(3e300), m<>(4e300)), AlmostEquals(m<>(5e300)));
+    REQUIRE_THAT(norm(m<>(3e-300), m<>(4e-300)), AlmostEquals(m<>(5e-300)));
+    REQUIRE_THAT(norm(km<>(3e303), m<>(4e306)), AlmostEquals(km<>(5e303)));
+  }
+
+  SECTION("special values")
+  {
+    REQUIRE(norm(m<>(0.), m<>(0.), m<>(0.)) == m<>(0.));
+    REQUIRE(norm(m<>(-std::numeric_limits<double>::infinity()), m<>(1.)).number() ==
+            std::numeric_limits<double>::infinity());
+    REQUIRE(norm(m<>(std::numeric_limits<double>::infinity()), m<>(std::numeric_limits<double>::quiet_NaN()))
+              .number() == std::numeric_limits<double>::infinity());
+    REQUIRE(std::isnan(norm(m<>(std::numeric_limits<double>::quiet_NaN()), m<>(1.)).number()));
+    REQUIRE(std::isnan(norm(m<>(std::numeric_limits<double>::quiet_NaN()), m<>(0.)).number()));
+  }
+
+  SECTION("range")
+  {
+    const std::array input = {m<>(1.), m<>(-2.), m<>(2.), m<>(4.)};
+    REQUIRE(norm(std::span(input)) == m<>(5.));
+    const std::array large = {m<>(1e300), m<>(-2e300), m<>(2e300), m<>(4e300)};
+    REQUIRE_THAT(norm(std::span(large)), AlmostEquals(m<>(5e300)));
+  }
+}
+
+TEST_CASE("'atan2()' on quantities of the same dimension", "[inv trig][atan2]")
+{
+  using namespace units::aliases;
+  using namespace units::aliases::isq::si;
+
+  SECTION("quadrants")
+  {
+    REQUIRE_THAT(atan2(m<>(1.), m<>(1.)), AlmostEquals(deg<>(45.)));
+    REQUIRE_THAT(atan2(m<>(1.), m<>(-1.)), AlmostEquals(deg<>(135.)));
+    REQUIRE_THAT(atan2(m<>(-1.), m<>(-1.)), AlmostEquals(deg<>(-135.)));
+    REQUIRE_THAT(atan2(m<>(-1.), m<>(1.)), AlmostEquals(deg<>(-45.)));
+  }
+
+  SECTION("same units return the result of std::atan2")
+  {
+    REQUIRE(atan2(m<>(3.), m<>(-4.)) == rad<>(std::atan2(3., -4.)));
+  }
+
+  SECTION("different units")
+  {
+    REQUIRE_THAT(atan2(km<>(1.), m<>(1000.)), AlmostEquals(deg<>(45.)));
+    REQUIRE_THAT(atan2(m<>(-1000.), km<>(0.)), AlmostEquals(deg<>(-90.)));
+  }
+}
+
+TEST_CASE("'sincos()' returns the sine and the cosine of an angle", "[trig][sincos]")
+{
+  using namespace units::aliases;
+
+  for (const double v : {0., 0.5, 1., -2., 3.5, 10., -100., 12345.678, 1e7}) {
+    const auto [s, c] = sincos(rad<>(v));
+    REQUIRE_THAT(s, AlmostEquals(sin(rad<>(v))));
+    REQUIRE_THAT(c, AlmostEquals(cos(rad<>(v))));
+  }
+  for (const double v : {0., 30., 90., -135., 720.}) {
+    const auto [s, c] = sincos(deg<>(v));
+    REQUIRE_THAT(s, AlmostEquals(sin(deg<>(v))));
+    REQUIRE_THAT(c, AlmostEquals(cos(deg<>(v))));
+  }
+}
+
+TEST_CASE("'sincos()' equals 'sin()' and 'cos()' at the multiples of 90 degrees", "[trig][sincos]")
+{
+  using namespace units::aliases;
+
+  for (int k = -16; k <= 16; ++k) {
+    const auto q = deg<>(90. * k);
+    const auto [s, c] = sincos(q);
+    REQUIRE(s == sin(q));
+    REQUIRE(c == cos(q));
+
+    const auto qf = deg<float>(90.f * static_cast<float>(k));
+    const auto [sf, cf] = sincos(qf);
+    REQUIRE(sf == sin(qf));
+    REQUIRE(cf == cos(qf));
+  }
+
+  const std::array input = {deg<>(-360.), deg<>(-180.), deg<>(-90.), deg<>(0.),   deg<>(90.),
+                            deg<>(180.),  deg<>(270.),  deg<>(360.), deg<>(1e6 * 90.)};
+  std::array<dimensionless<one>, input.size()> sines{};
+  std::array<dimensionless<one>, input.size()> cosines{};
+  sincos(std::span(input), std::span(sines), std::span(cosines));
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    REQUIRE(sines[i] == sin(input[i]));
+    REQUIRE(cosines[i] == cos(input[i]));
+  }
+}
+
+TEST_CASE("math functions on ranges of quantities", "[math][range]")
+{
+  using namespace units::aliases;
+  using namespace units::aliases::isq::si;
+
+  SECTION("sqrt")
+  {
+    const std::array input = {m2<>(4.), m2<>(9.), m2<>(2.)};
+    std::array<m<>, 3> output{};
+    sqrt(std::span(input), std::span(output));
+    for (std::size_t i = 0; i < input.size(); ++i) REQUIRE(output[i] == sqrt(input[i]));
+  }
+
+  SECTION("hypot with different units")
+  {
+    const std::array x = {km<>(3.), km<>(2.), km<>(0.)};
+    const std::array y = {m<>(4000.), m<>(1.), m<>(5.)};
+    std::array<m<>, 3> output{};
+    hypot(std::span(x), std::span(y), std::span(output));
+    for (std::size_t i = 0; i < x.size(); ++i) REQUIRE_THAT(output[i], AlmostEquals(hypot(x[i], y[i])));
+  }
+
+  SECTION("sin and cos of degrees")
+  {
+    const std::array input = {deg<>(0.), deg<>(30.), deg<>(90.), deg<>(-135.), deg<>(720.)};
+    std::array<dimensionless<one>, 5> sines{};
+    std::array<dimensionless<one>, 5> cosines{};
+    sin(std::span(input), std::span(sines));
+    cos(std::span(input), std::span(cosines));
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      REQUIRE_THAT(sines[i], AlmostEquals(sin(input[i])));
+      REQUIRE_THAT(cosines[i], AlmostEquals(cos(input[i])));
+    }
+  }
+
+  SECTION("sin of radians")
+  {
+    const std::array input = {rad<>(0.), rad<>(0.5), rad<>(-2.)};
+    std::array<dimensionless<one>, 3> output{};
+    sin(std::span(input), std::span(output));
+    for (std::size_t i = 0; i < input.size(); ++i) REQUIRE(output[i] == sin(input[i]));
+  }
+
+  SECTION("atan2 with different units")
+  {
+    const std::array y = {km<>(1.), km<>(-2.), km<>(0.)};
+    const std::array x = {m<>(1000.), m<>(1.), m<>(-5.)};
+    std::array<rad<>, 3> output{};
+    atan2(std::span(y), std::span(x), std::span(output));
+    for (std::size_t i = 0; i < y.size(); ++i) REQUIRE_THAT(output[i], AlmostEquals(atan2(y[i], x[i])));
+  }
+
+  SECTION("sincos of degrees")
+  {
+    const std::array input = {deg<>(0.), deg<>(30.), deg<>(90.), deg<>(-135.), deg<>(720.)};
+    std::array<dimensionless<one>, 5> sines{};
+    std::array<dimensionless<one>, 5> cosines{};
+    sincos(std::span(input), std::span(sines), std::span(cosines));
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      REQUIRE_THAT(sines[i], AlmostEquals(sin(input[i])));
+      REQUIRE_THAT(cosines[i], AlmostEquals(cos(input[i])));
+    }
+  }
+
+  SECTION("exp of percents")
+  {
+    const std::array input = {dimensionless<percent>(0.), dimensionless<percent>(50.), dimensionless<percent>(-200.)};
+    std::array<dimensionless<percent>, 3> output{};
+    exp(std::span(input), std::span(output));
+    for (std::size_t i = 0; i < input.size(); ++i) REQUIRE_THAT(output[i], AlmostEquals(exp(input[i])));
+  }
+}
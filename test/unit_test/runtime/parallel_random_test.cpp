@@ -0,0 +1,197 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/isq/si/length.h>
+#include <units/parallel_random.h>
+#include <units/random.h>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <execution>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+// the known answers of the Random123 library
+static_assert(detail::philox4x32<10>({0, 0, 0, 0}, {0, 0}) ==
+              std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+static_assert(detail::philox4x32<10>({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+              std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+static_assert(detail::philox4x32<10>({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+              std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+
+static_assert(std::uniform_random_bit_generator<philox4x32_10>);
+
+template<typename Policy, typename Distribution, typename Q>
+concept parallel_generatable =
+  requires(Policy policy, const Distribution& d, philox4x32_10& g, std::span<Q> out) {
+    parallel_generate(policy, d, g, out);
+  };
+
+// the distributions that allocate when copied cannot be used with the unsequenced policies
+static_assert(parallel_generatable<std::execution::parallel_unsequenced_policy,
+                                   units::normal_distribution<length<metre>>, length<metre>>);
+static_assert(parallel_generatable<std::execution::parallel_policy,
+                                   units::discrete_distribution<length<metre, int>>, length<metre, int>>);
+static_assert(!parallel_generatable<std::execution::parallel_unsequenced_policy,
+                                    units::discrete_distribution<length<metre, int>>, length<metre, int>>);
+
+TEST_CASE("philox_engine")
+{
+  SECTION("the numbers are the bijections of the counter")
+  {
+    philox4x32_10 gen(0x299f31d0a4093822, 0x0370734413198a2e);
+    gen.discard(2 * std::uint64_t{0x05a308d3243f6a88});
+    const auto block =
+      detail::philox4x32<10>({0x243f6a88, 0x05a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+    CHECK(gen() == ((std::uint64_t{block[1]} << 32) | block[0]));
+    CHECK(gen() == ((std::uint64_t{block[3]} << 32) | block[2]));
+  }
+
+  SECTION("the same seed gives the same numbers")
+  {
+    philox4x32_10 gen1(42);
+    philox4x32_10 gen2(42);
+    for (int i = 0; i < 1000; ++i) CHECK(gen1() == gen2());
+    CHECK(gen1 == gen2);
+
+    gen1.seed(42);
+    CHECK(gen1 != gen2);
+    CHECK(gen1 == philox4x32_10(42));
+  }
+
+  SECTION("discard jumps ahead")
+  {
+    for (unsigned long long z : {0ULL, 1ULL, 2ULL, 7ULL, 1000ULL}) {
+      philox4x32_10 gen1(42);
+      philox4x32_10 gen2(42);
+      for (unsigned long long i = 0; i < z; ++i) gen1();
+      gen2.discard(z);
+      CHECK(gen1 == gen2);
+      for (int i = 0; i < 10; ++i) CHECK(gen1() == gen2());
+    }
+  }
+
+  SECTION("streams are independent of each other")
+  {
+    philox4x32_10 gen(42);
+    gen.discard(123);
+    const philox4x32_10 stream1 = gen.split(1);
+    CHECK(stream1.stream() == 1);
+    CHECK(stream1 == philox4x32_10(42, 1));
+    CHECK(gen.split(0) == philox4x32_10(42));
+
+    philox4x32_10 gen0(42, 0);
+    philox4x32_10 gen1 = stream1;
+    std::size_t same = 0;
+    for (int i = 0; i < 1000; ++i) same += gen0() == gen1() ? std::size_t{1} : 0;
+    CHECK(same == 0);
+  }
+
+  SECTION("the numbers are uniformly distributed")
+  {
+    philox4x32_10 gen(42);
+    std::array<std::size_t, 16> counts{};
+    for (int i = 0; i < 160'000; ++i) ++counts[gen() >> 60];
+    for (std::size_t c : counts) CHECK(std::abs(static_cast<double>(c) - 10'000.) < 500);
+  }
+
+  SECTION("the distributions use it")
+  {
+    philox4x32_10 gen(42);
+    auto dist = units::normal_distribution<length<metre>>(1.0_q_m, 2.0_q_m);
+    double sum = 0;
+    for (int i = 0; i < 100'000; ++i) sum += dist(gen).number();
+    CHECK(std::abs(sum / 100'000 - 1.0) < 0.05);
+  }
+}
+
+TEST_CASE("parallel_generate")
+{
+  using q = length<metre>;
+  const auto dist = units::normal_distribution<q>(1.0_q_m, 2.0_q_m);
+
+  // a size that is not a multiple of the blocks
+  const std::size_t size = 10 * detail::parallel_generate_block_size + 123;
+
+  philox4x32_10 gen(42);
+  std::vector<q> samples(size);
+  parallel_generate(std::execution::seq, dist, gen, std::span(samples));
+
+  SECTION("the blocks are generated from the jumped ahead engine")
+  {
+    philox4x32_10 expected_gen(42);
+    for (std::size_t offset = 0; offset < size; offset += detail::parallel_generate_block_size) {
+      philox4x32_10 block_gen = expected_gen;
+      block_gen.discard(offset / detail::parallel_generate_block_size * detail::parallel_generate_block_stride);
+      auto block_dist = dist;
+      const std::size_t n = std::min(detail::parallel_generate_block_size, size - offset);
+      std::vector<q> block(n);
+      block_dist.generate(block_gen, std::span(block));
+      for (std::size_t i = 0; i < n; ++i) CHECK(samples[offset + i] == block[i]);
+    }
+
+    expected_gen.discard(11 * detail::parallel_generate_block_stride);
+    CHECK(gen == expected_gen);
+  }
+
+  SECTION("the results do not depend on the execution policy")
+  {
+    philox4x32_10 unseq_gen(42);
+    std::vector<q> unseq_samples(size);
+    parallel_generate(std::execution::unseq, dist, unseq_gen, std::span(unseq_samples));
+    CHECK(unseq_samples == samples);
+    CHECK(unseq_gen == gen);
+  }
+
+  SECTION("the results do not depend on the number of threads")
+  {
+    // each thread fills one half of the range from a copy of the engine
+    philox4x32_10 thread_gen(42);
+    std::vector<q> thread_samples(size);
+    const std::size_t half = 5 * detail::parallel_generate_block_size;
+    std::thread t1([&] {
+      philox4x32_10 g = thread_gen;
+      parallel_generate(std::execution::seq, dist, g, std::span(thread_samples).first(half));
+    });
+    std::thread t2([&] {
+      philox4x32_10 g = thread_gen;
+      g.discard(5 * detail::parallel_generate_block_stride);
+      parallel_generate(std::execution::seq, dist, g, std::span(thread_samples).subspan(half));
+    });
+    t1.join();
+    t2.join();
+    CHECK(thread_samples == samples);
+  }
+
+  SECTION("the next call continues with new numbers")
+  {
+    std::vector<q> next(size);
+    parallel_generate(std::execution::seq, dist, gen, std::span(next));
+    CHECK(next != samples);
+  }
+}
@@ -0,0 +1,285 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/isq/iec80000/storage_capacity.h>
+#include <units/isq/si/international/length.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/time.h>
+#include <units/quantity_cast.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+// checks all the policies for every number of the source representation type against the exact result
+template<typename To, typename From>
+void check_all_numbers()
+{
+  using from_rep = TYPENAME From::rep;
+  using to_rep = TYPENAME To::rep;
+  constexpr Magnitude auto mag = detail::cast_magnitude<From, To>;
+  constexpr auto num = get_value<std::int64_t>(numerator(mag));
+  constexpr auto den = get_value<std::int64_t>(denominator(mag));
+
+  std::int64_t failed = 0;
+  for (std::int64_t v = std::numeric_limits<from_rep>::lowest(); v <= std::numeric_limits<from_rep>::max(); ++v) {
+    const From q(static_cast<from_rep>(v));
+    const std::int64_t exact = v * num / den;
+    const bool fits = std::in_range<to_rep>(exact);
+    const to_rep limit = exact < 0 ? std::numeric_limits<to_rep>::lowest() : std::numeric_limits<to_rep>::max();
+    const to_rep saturated = fits ? static_cast<to_rep>(exact) : limit;
+
+    if (quantity_cast<To>(q, overflow::wrapping).number() != static_cast<to_rep>(exact)) ++failed;
+    if (quantity_cast<To>(q, overflow::saturating).number() != saturated) ++failed;
+    try {
+      if (quantity_cast<To>(q, overflow::checked).number() != static_cast<to_rep>(exact) || !fits) ++failed;
+    } catch (const std::overflow_error&) {
+      if (fits) ++failed;
+    }
+  }
+  CHECK(failed == 0);
+}
+
+// checks all the rounding modes for every number of the source representation type against `long double` rounding
+template<typename To, typename From>
+void check_all_roundings()
+{
+  using from_rep = TYPENAME From::rep;
+  using to_rep = TYPENAME To::rep;
+  constexpr Magnitude auto mag = detail::cast_magnitude<From, To>;
+  constexpr auto num = get_value<std::int64_t>(numerator(mag));
+  constexpr auto den = get_value<std::int64_t>(denominator(mag));
+
+  const auto to_number = [](long double v) { return static_cast<to_rep>(static_cast<std::int64_t>(v)); };
+  std::int64_t failed = 0;
+  for (std::int64_t v = std::numeric_limits<from_rep>::lowest(); v <= std::numeric_limits<from_rep>::max(); ++v) {
+    const From q(static_cast<from_rep>(v));
+    const long double exact = static_cast<long double>(v * num) / static_cast<long double>(den);
+    const long double lower = std::floor(exact);
+    const long double tie_to_even = std::fmod(lower, 2.0L) == 0 ? lower : lower + 1;
+    const long double even = exact - lower == 0.5L ? tie_to_even : std::round(exact);
+
+    if (quantity_cast<To>(q, rounding::toward_zero).number() != to_number(std::trunc(exact))) ++failed;
+    if (quantity_cast<To>(q, rounding::floor).number() != to_number(lower)) ++failed;
+    if (quantity_cast<To>(q, rounding::ceil).number() != to_number(std::ceil(exact))) ++failed;
+    if (quantity_cast<To>(q, rounding::half_to_even).number() != to_number(even)) ++failed;
+    if (quantity_cast<To>(q, rounding::half_away_from_zero).number() != to_number(std::round(exact))) ++failed;
+  }
+  CHECK(failed == 0);
+}
+
+// checks the plain and the rounded casts of the numbers in [first, last] against the 64-bit integer division
+// (exact as the products of 32-bit numbers and the small numerators used below fit in 64 bits)
+template<typename To, typename From>
+std::int64_t count_wrong_divisions(std::int64_t first, std::int64_t last)
+{
+  using from_rep = TYPENAME From::rep;
+  using to_rep = TYPENAME To::rep;
+  constexpr Magnitude auto mag = detail::cast_magnitude<From, To>;
+  constexpr auto num = get_value<std::int64_t>(numerator(mag));
+  constexpr auto den = get_value<std::int64_t>(denominator(mag));
+
+  std::int64_t failed = 0;
+  for (std::int64_t v = first; v <= last; ++v) {
+    const From q(static_cast<from_rep>(v));
+    const std::int64_t quotient = v * num / den;
+    const bool inexact_negative = v * num < 0 && v * num % den != 0;
+    const auto truncated = static_cast<to_rep>(quotient);
+    const auto floored = static_cast<to_rep>(inexact_negative ? quotient - 1 : quotient);
+    if (quantity_cast<To>(q).number() != truncated) ++failed;
+    if (quantity_cast<To>(q, rounding::floor).number() != floored) ++failed;
+  }
+  return failed;
+}
+
+template<typename To, typename From>
+void check_divisions(bool exhaustive)
+{
+  using from_rep = TYPENAME From::rep;
+  constexpr std::int64_t min = std::numeric_limits<from_rep>::lowest();
+  constexpr std::int64_t max = std::numeric_limits<from_rep>::max();
+  constexpr std::int64_t edge = 1 << 16;
+
+  if (exhaustive) {
+    CHECK(count_wrong_divisions<To, From>(min, max) == 0);
+  } else {
+    CHECK(count_wrong_divisions<To, From>(min, min + edge) == 0);
+    CHECK(count_wrong_divisions<To, From>(std::max(min, -edge), edge) == 0);
+    CHECK(count_wrong_divisions<To, From>(max - edge, max) == 0);
+  }
+}
+
+void check_32_bit_divisions(bool exhaustive)
+{
+  using namespace si::international;
+  check_divisions<si::length<yard, std::int32_t>, si::length<foot, std::int32_t>>(exhaustive);
+  check_divisions<si::length<yard, std::uint32_t>, si::length<foot, std::uint32_t>>(exhaustive);
+  check_divisions<si::time<si::second, std::int32_t>, si::time<si::millisecond, std::int32_t>>(exhaustive);
+  check_divisions<si::time<si::minute, std::uint32_t>, si::time<si::second, std::uint32_t>>(exhaustive);
+  check_divisions<si::length<foot, std::int32_t>, si::length<si::metre, std::int32_t>>(exhaustive);
+  check_divisions<si::length<si::metre, std::int32_t>, si::length<foot, std::int32_t>>(exhaustive);
+}
+
+}  // namespace
+
+TEST_CASE("quantity_cast with an overflow policy", "[quantity_cast][overflow]")
+{
+  SECTION("integral multiplier")
+  {
+    check_all_numbers<si::time<si::millisecond, std::int16_t>, si::time<si::second, std::int16_t>>();
+    check_all_numbers<si::time<si::nanosecond, std::int32_t>, si::time<si::second, std::int16_t>>();
+    check_all_numbers<si::time<si::millisecond, std::uint16_t>, si::time<si::second, std::int16_t>>();
+    check_all_numbers<iec80000::storage_capacity<iec80000::bit, std::uint32_t>,
+                      iec80000::storage_capacity<iec80000::gibibyte, std::uint16_t>>();
+  }
+
+  SECTION("integral divisor")
+  {
+    check_all_numbers<si::time<si::second, std::int8_t>, si::time<si::millisecond, std::int16_t>>();
+    check_all_numbers<si::time<si::second, std::uint8_t>, si::time<si::millisecond, std::int16_t>>();
+  }
+
+  SECTION("rational factor")
+  {
+    check_all_numbers<si::length<si::metre, std::int16_t>, si::length<si::international::mile, std::int16_t>>();
+    check_all_numbers<si::length<si::metre, std::int32_t>, si::length<si::international::mile, std::int16_t>>();
+    check_all_numbers<si::length<si::international::foot, std::int16_t>, si::length<si::metre, std::int16_t>>();
+    check_all_numbers<si::length<si::international::foot, std::uint8_t>, si::length<si::metre, std::int8_t>>();
+  }
+
+  SECTION("no overflow possible")
+  {
+    check_all_numbers<si::time<si::millisecond, std::int32_t>, si::time<si::second, std::int16_t>>();
+    check_all_numbers<si::time<si::second, std::int8_t>, si::time<si::millisecond, std::int8_t>>();
+  }
+
+  SECTION("64-bit limits")
+  {
+    using ns = si::time<si::nanosecond, std::int64_t>;
+    constexpr auto max = std::numeric_limits<std::int64_t>::max();
+    constexpr auto min = std::numeric_limits<std::int64_t>::min();
+
+    CHECK(quantity_cast<ns>(si::time<si::second, std::int64_t>(9'223'372'036), overflow::checked).number() ==
+          9'223'372'036'000'000'000);
+    CHECK_THROWS_AS(quantity_cast<ns>(si::time<si::second, std::int64_t>(9'223'372'037), overflow::checked),
+                    std::overflow_error);
+    CHECK(quantity_cast<ns>(si::time<si::second, std::int64_t>(max / 2), overflow::saturating).number() == max);
+    CHECK(quantity_cast<ns>(si::time<si::second, std::int64_t>(min), overflow::saturating).number() == min);
+    CHECK(quantity_cast<si::time<si::second, std::int64_t>>(ns(min), overflow::checked).number() ==
+          min / 1'000'000'000);
+    CHECK(quantity_cast<si::time<si::second, std::uint64_t>>(ns(min), overflow::saturating).number() == 0);
+    CHECK(quantity_cast<std::uint64_t>(ns(-1), overflow::wrapping).number() ==
+          std::numeric_limits<std::uint64_t>::max());
+  }
+}
+
+TEST_CASE("quantity_cast with a rounding mode", "[quantity_cast][rounding]")
+{
+  SECTION("integral divisor")
+  {
+    check_all_roundings<si::length<si::metre, std::int16_t>, si::length<si::millimetre, std::int16_t>>();
+    check_all_roundings<si::length<si::metre, std::int32_t>, si::length<si::centimetre, std::int16_t>>();
+    check_all_roundings<si::time<si::minute, std::int16_t>, si::time<si::second, std::int16_t>>();
+    check_all_roundings<si::time<si::second, std::uint16_t>, si::time<si::millisecond, std::uint16_t>>();
+  }
+
+  SECTION("rational factor")
+  {
+    check_all_roundings<si::length<si::international::foot, std::int32_t>, si::length<si::metre, std::int16_t>>();
+    check_all_roundings<si::length<si::international::mile, std::int16_t>, si::length<si::metre, std::int16_t>>();
+    using namespace si::international;
+    check_all_roundings<si::length<yard, std::int16_t>, si::length<foot, std::int16_t>>();
+  }
+
+  SECTION("integral multiplier")
+  {
+    check_all_roundings<si::time<si::millisecond, std::int32_t>, si::time<si::second, std::int16_t>>();
+  }
+
+  SECTION("64-bit limits")
+  {
+    using namespace si::international;
+    constexpr auto max = std::numeric_limits<long long>::max();
+    constexpr auto min = std::numeric_limits<long long>::min();
+
+    CHECK(quantity_cast<si::metre>(si::length<foot, long long>(max / 2), rounding::floor).number() ==
+          1'405'641'898'416'667'832);
+    CHECK(quantity_cast<si::metre>(si::length<foot, long long>(max / 2), rounding::ceil).number() ==
+          1'405'641'898'416'667'833);
+    CHECK(quantity_cast<si::metre>(si::length<foot, long long>(min / 2), rounding::floor).number() ==
+          -1'405'641'898'416'667'834);
+    CHECK(quantity_cast<si::metre>(si::length<foot, long long>(max), rounding::half_to_even).number() ==
+          2'811'283'796'833'335'666);
+    CHECK(quantity_cast<foot>(si::length<si::metre, long long>(max / 4), rounding::half_away_from_zero).number() ==
+          7'565'101'736'265'400'102);
+    CHECK(quantity_cast<si::second>(si::time<si::millisecond, long long>(min), rounding::half_to_even).number() ==
+          min / 1000 - 1);
+  }
+
+  SECTION("ranges")
+  {
+    const std::vector<si::length<si::millimetre, int>> input = {
+      si::length<si::millimetre, int>(-2500), si::length<si::millimetre, int>(-1500),
+      si::length<si::millimetre, int>(-499), si::length<si::millimetre, int>(500),
+      si::length<si::millimetre, int>(1500), si::length<si::millimetre, int>(2501)};
+    std::array<si::length<si::metre, int>, 6> output{};
+
+    quantity_cast(std::span(input), std::span(output), rounding::half_to_even);
+    CHECK(output == std::array{si::length<si::metre, int>(-2), si::length<si::metre, int>(-2),
+                               si::length<si::metre, int>(0), si::length<si::metre, int>(0),
+                               si::length<si::metre, int>(2), si::length<si::metre, int>(3)});
+
+    quantity_cast(std::span(input), std::span(output), rounding::floor);
+    CHECK(output == std::array{si::length<si::metre, int>(-3), si::length<si::metre, int>(-2),
+                               si::length<si::metre, int>(-1), si::length<si::metre, int>(0),
+                               si::length<si::metre, int>(1), si::length<si::metre, int>(2)});
+
+    quantity_cast(std::span(input), std::span(output));
+    CHECK(output == std::array{si::length<si::metre, int>(-2), si::length<si::metre, int>(-1),
+                               si::length<si::metre, int>(0), si::length<si::metre, int>(0),
+                               si::length<si::metre, int>(1), si::length<si::metre, int>(2)});
+
+    std::array<si::length<si::millimetre, std::int16_t>, 6> narrow{};
+    quantity_cast(std::span(input), std::span(narrow), overflow::saturating);
+    CHECK(narrow[0].number() == -2500);
+  }
+}
+
+TEST_CASE("quantity_cast with a compile-time divisor", "[quantity_cast]")
+{
+  check_32_bit_divisions(false);
+}
+
+TEST_CASE("quantity_cast with a compile-time divisor for every 32-bit number", "[quantity_cast][.exhaustive]")
+{
+  check_32_bit_divisions(true);
+}
@@ -0,0 +1,171 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <units/format.h>
+#include <units/isq/iec80000/storage_capacity.h>
+#include <units/isq/si/prefixes.h>
+#include <units/quantity_io.h>
+#include <units/wide_int.h>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <sstream>
+
+using namespace units;
+using namespace units::isq;
+using namespace units::isq::iec80000;
+
+namespace {
+
+using int128 = wide_int<128>;
+using int256 = wide_int<256>;
+
+}  // namespace
+
+TEST_CASE("wide_int", "[wide_int]")
+{
+  SECTION("is a representation type")
+  {
+    STATIC_REQUIRE(Representation<int128>);
+    STATIC_REQUIRE(!treat_as_floating_point<int128>);
+    STATIC_REQUIRE(std::is_same_v<std::common_type_t<int128, std::intmax_t>, int128>);
+    STATIC_REQUIRE(std::is_same_v<std::common_type_t<int128, int256>, int256>);
+    STATIC_REQUIRE(std::is_same_v<std::common_type_t<int128, double>, double>);
+  }
+
+  SECTION("arithmetic")
+  {
+    STATIC_REQUIRE(int128(5) * int128(-7) == -35);
+    STATIC_REQUIRE(int128(-36) / 7 == -5);
+    STATIC_REQUIRE(int128(-36) % 7 == -1);
+    STATIC_REQUIRE((int128(1) << 100) / (int128(1) << 40) == int128(1) << 60);
+    STATIC_REQUIRE((int128(-1) >> 100) == -1);
+    STATIC_REQUIRE(std::numeric_limits<int128>::max() + 1 == std::numeric_limits<int128>::min());
+    STATIC_REQUIRE(int256(int128(-3)) == -3);
+    STATIC_REQUIRE(static_cast<std::int64_t>(int256(1) << 200 | 42) == 42);
+    STATIC_REQUIRE(static_cast<double>(int128(1) << 100) == 0x1p100);
+    STATIC_REQUIRE(int128(-0x1p100) == -(int128(1) << 100));
+  }
+
+#if defined(__SIZEOF_INT128__)
+  SECTION("matches the built-in 128-bit integers")
+  {
+    using builtin = detail::int128_t;
+    using ubuiltin = detail::uint128_t;
+    std::mt19937_64 gen;
+    const auto random = [&] {
+      const auto v = static_cast<builtin>(static_cast<ubuiltin>(gen()) << 64 | gen()) >> (gen() % 127);
+      return gen() % 2 ? v : -v;
+    };
+    // the arithmetic of the unsigned integers wraps around instead of overflowing
+    const auto wrapped = [](builtin a, builtin b, auto op) {
+      return static_cast<builtin>(op(static_cast<ubuiltin>(a), static_cast<ubuiltin>(b)));
+    };
+    for (int i = 0; i < 10'000; ++i) {
+      const builtin a = random(), b = random();
+      const int shift = static_cast<int>(gen() % 128);
+      CHECK(static_cast<builtin>(int128(a) + int128(b)) == wrapped(a, b, std::plus<>{}));
+      CHECK(static_cast<builtin>(int128(a) - int128(b)) == wrapped(a, b, std::minus<>{}));
+      CHECK(static_cast<builtin>(int128(a) * int128(b)) == wrapped(a, b, std::multiplies<>{}));
+      if (b != 0 && b != -1) {
+        CHECK(static_cast<builtin>(int128(a) / int128(b)) == a / b);
+        CHECK(static_cast<builtin>(int128(a) % int128(b)) == a % b);
+      }
+      CHECK((int128(a) < int128(b)) == (a < b));
+      CHECK(static_cast<builtin>(int128(a) >> shift) == a >> shift);
+      CHECK(static_cast<builtin>(int128(a) << shift) == static_cast<builtin>(static_cast<ubuiltin>(a) << shift));
+    }
+  }
+#endif
+
+  SECTION("numeric limits")
+  {
+    using limits = std::numeric_limits<int128>;
+    STATIC_REQUIRE(limits::is_specialized && limits::is_integer && limits::is_exact && limits::is_modulo);
+    STATIC_REQUIRE(!limits::has_infinity && !limits::has_quiet_NaN && !limits::has_signaling_NaN);
+    STATIC_REQUIRE(limits::digits == 127);
+    STATIC_REQUIRE(limits::digits10 == 38);
+    STATIC_REQUIRE(limits::max_digits10 == 0);
+    STATIC_REQUIRE(limits::round_style == std::round_toward_zero);
+    STATIC_REQUIRE(limits::epsilon() == 0);
+    STATIC_REQUIRE(limits::round_error() == 0);
+#if defined(__SIZEOF_INT128__)
+    STATIC_REQUIRE(limits::digits10 == std::numeric_limits<detail::int128_t>::digits10);
+    STATIC_REQUIRE(limits::traps == std::numeric_limits<detail::int128_t>::traps);
+#endif
+  }
+
+  SECTION("text output")
+  {
+    std::ostringstream os;
+    os << std::numeric_limits<int128>::min() << ' ' << std::hex << std::showbase << int128(255) << std::dec << ' '
+       << std::showpos << int128(42);
+    CHECK(os.str() == "-170141183460469231731687303715884105728 0xff +42");
+
+    CHECK(UNITS_STD_FMT::format("{}|{:#x}|{:+}|{:b}", int256(-42), int128(255), int128(1), int128(5)) ==
+          "-42|0xff|+1|101");
+    CHECK(UNITS_STD_FMT::format("{:>6}|{:*<6}|{:^7}|{:06}|{:#010X}|{: d}|{:{}}", int128(42), int128(-42), int128(42),
+                                int128(-42), int128(255), int128(7), int128(5), 3) == "    42|-42***|  42   |-00042|0X000000FF| 7|  5");
+    CHECK(UNITS_STD_FMT::format("{:>6}", int128(42)) == UNITS_STD_FMT::format("{:>6}", 42));
+    CHECK(UNITS_STD_FMT::format("{:06}", int128(-42)) == UNITS_STD_FMT::format("{:06}", -42));
+    CHECK(UNITS_STD_FMT::format("{:#010X}", int128(255)) == UNITS_STD_FMT::format("{:#010X}", 255));
+  }
+}
+
+TEST_CASE("exact conversions of storage capacities", "[wide_int]")
+{
+  SECTION("wide_int")
+  {
+    const auto c = storage_capacity<yottabyte, int128>(5);
+    CHECK(quantity_cast<bit>(c).number() == int128(40'000'000'000'000) * 1'000'000'000'000);
+    CHECK(quantity_cast<kilobit>(storage_capacity<pebibyte, int128>(1000)).number() == int128(1) << 53);
+    CHECK(quantity_cast<yottabyte>(quantity_cast<bit>(c)) == c);
+
+    std::ostringstream os;
+    os << quantity_cast<bit>(c);
+    CHECK(os.str() == "40000000000000000000000000 bit");
+    CHECK(UNITS_STD_FMT::format("{}", quantity_cast<bit>(c)) == os.str());
+    CHECK(UNITS_STD_FMT::format("{:%#xQ %q}", c) == "0x5 YB");
+  }
+
+#if defined(__SIZEOF_INT128__)
+  SECTION("built-in 128-bit integers")
+  {
+    const auto c = storage_capacity<yottabyte, detail::int128_t>(5);
+    CHECK(quantity_cast<bit>(c).number() == static_cast<detail::int128_t>(40'000'000'000'000) * 1'000'000'000'000);
+    CHECK(quantity_cast<kilobit>(storage_capacity<pebibyte, detail::uint128_t>(1000U)).number() ==
+          static_cast<detail::uint128_t>(1) << 53);
+
+    std::ostringstream os;
+    os << quantity_cast<bit>(c);
+    CHECK(os.str() == "40000000000000000000000000 bit");
+    CHECK(UNITS_STD_FMT::format("{}", quantity_cast<bit>(c)) == os.str());
+
+    std::ostringstream hex;
+    hex << std::hex << std::showbase << std::uppercase << storage_capacity<bit, detail::int128_t>(-255) << ' '
+        << storage_capacity<bit, detail::uint128_t>(std::numeric_limits<detail::uint128_t>::max());
+    CHECK(hex.str() == "-0XFF bit 0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF bit");
+  }
+#endif
+}
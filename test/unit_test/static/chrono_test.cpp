@@ -26,6 +26,7 @@
 #include <units/isq/si/length.h>
 #include <units/isq/si/speed.h>
 #include <units/quantity_point.h>
+#include <cstdint>
 #include <ratio>
 
 namespace {
@@ -108,6 +109,16 @@ static_assert(is_same_v<decltype(to_std_duration(1_q_s))::period, std::ratio<1>>
 static_assert(is_same_v<decltype(to_std_duration(2_q_h))::period, std::ratio<3600>>);
 static_assert(is_same_v<decltype(to_std_duration(3_q_ns))::period, std::nano>);
 
+// clock_now
+static_assert(std::chrono::is_clock_v<tsc_clock>);
+static_assert(compare<decltype(clock_now<std::chrono::steady_clock>()),
+                      time_point<std::chrono::steady_clock, si::nanosecond, std::chrono::steady_clock::rep>>);
+static_assert(compare<decltype(clock_now<std::chrono::system_clock, si::second, double>()),
+                      time_point<std::chrono::system_clock, si::second>>);
+static_assert(compare<decltype(clock_now<tsc_clock>()), time_point<tsc_clock, si::nanosecond, std::int64_t>>);
+static_assert(compare<decltype(clock_now<tsc_clock, si::microsecond>()),
+                      time_point<tsc_clock, si::microsecond, std::int64_t>>);
+
 // to_std_time_point
 static_assert(to_std_time_point(quantity_point{sys_seconds{1s}}) == sys_seconds{1s});
 static_assert(to_std_time_point(quantity_point{sys_days{sys_days::duration{1}}}) == sys_days{sys_days::duration{1}});
@@ -0,0 +1,122 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "test_tools.h"
+#include <units/fixed_point.h>
+#include <units/generic/angle.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq;
+
+using q15_16 = fixed_point<std::int32_t, 16>;
+using q7_8 = fixed_point<std::int16_t, 8>;
+using uq16_16 = fixed_point<std::uint32_t, 16>;
+using q31_32 = fixed_point<std::int64_t, 32>;
+
+// representation
+static_assert(Representation<q15_16>);
+static_assert(Representation<q7_8>);
+static_assert(Representation<uq16_16>);
+static_assert(!treat_as_floating_point<q15_16>);
+static_assert(std::is_same_v<std::common_type_t<q15_16, std::intmax_t>, q15_16>);
+static_assert(std::is_same_v<std::common_type_t<q15_16, q7_8>, q15_16>);
+static_assert(std::is_same_v<std::common_type_t<q15_16, double>, double>);
+
+// construction and conversions
+static_assert(q15_16(3).raw() == 3 << 16);
+static_assert(q15_16(-3).raw() == -3 << 16);
+static_assert(q15_16(1.5).raw() == 0x18000);
+static_assert(q15_16(-1.5).raw() == -0x18000);
+static_assert(q15_16(0.1).raw() == 6554);
+static_assert(static_cast<double>(q15_16(2.25)) == 2.25);
+static_assert(static_cast<int>(q15_16(2.75)) == 2);
+static_assert(static_cast<int>(q15_16(-2.25)) == -3);
+static_assert(q15_16(q7_8(1.5)) == q15_16(1.5));
+static_assert(q7_8(q15_16::from_raw(0x18080)) == q7_8(1.5));
+
+// arithmetic
+static_assert(q15_16(1.5) + q15_16(2.25) == q15_16(3.75));
+static_assert(q15_16(1.5) - q15_16(2.25) == q15_16(-0.75));
+static_assert(-q15_16(1.5) == q15_16(-1.5));
+static_assert(q15_16(1.5) * q15_16(-2.5) == q15_16(-3.75));
+static_assert(q15_16(-3.75) / q15_16(1.5) == q15_16(-2.5));
+static_assert(q31_32(1e6) * q31_32(1e3) == q31_32(1e9));
+static_assert(q31_32(1e9) / q31_32(1e6) == q31_32(1e3));
+static_assert(uq16_16(1.5) * uq16_16(2.5) == uq16_16(3.75));
+static_assert(q15_16(1) < q15_16(1.5));
+
+// quantity_values
+static_assert(si::length<si::metre, q15_16>::zero().number() == q15_16(0));
+static_assert(si::length<si::metre, q15_16>::one().number() == q15_16(1));
+static_assert(si::length<si::metre, q15_16>::min().number().raw() == std::numeric_limits<std::int32_t>::min());
+static_assert(si::length<si::metre, q15_16>::max().number().raw() == std::numeric_limits<std::int32_t>::max());
+
+// quantities
+static_assert(si::length<si::metre, q15_16>(q15_16(1.5)) + si::length<si::metre, q15_16>(q15_16(2)) ==
+              si::length<si::metre, q15_16>(q15_16(3.5)));
+static_assert(si::length<si::metre, q15_16>(q15_16(3)) / si::time<si::second, q15_16>(q15_16(2)) ==
+              si::speed<si::metre_per_second, q15_16>(q15_16(1.5)));
+static_assert(si::length<si::metre, q15_16>(2) * 3 == si::length<si::metre, q15_16>(6));
+
+// implicit conversions only to the units with the integral magnitudes
+static_assert(std::convertible_to<si::length<si::metre, q15_16>, si::length<si::millimetre, q15_16>>);
+static_assert(!std::convertible_to<si::length<si::millimetre, q15_16>, si::length<si::metre, q15_16>>);
+static_assert(si::length<si::millimetre, q15_16>(si::length<si::metre, q15_16>(q15_16(1.5))).number() == 1500);
+
+// quantity_cast between fixed-point numbers
+static_assert(quantity_cast<si::millimetre>(si::length<si::metre, q15_16>(q15_16(1.5))).number() == 1500);
+static_assert(quantity_cast<si::metre>(si::length<si::millimetre, q15_16>(1500)).number() == q15_16(1.5));
+static_assert(quantity_cast<si::metre>(si::length<si::millimetre, q15_16>(1)).number() == q15_16::from_raw(66));
+static_assert(quantity_cast<si::metre>(si::length<si::millimetre, q15_16>(-1)).number() == q15_16::from_raw(-66));
+static_assert(quantity_cast<si::kilometre>(si::length<si::metre, q15_16>(q15_16(0.001))).number() ==
+              q15_16::from_raw(0));
+static_assert(quantity_cast<si::kilometre_per_hour>(si::speed<si::metre_per_second, q15_16>(10)).number() == 36);
+static_assert(quantity_cast<si::metre_per_second>(si::speed<si::kilometre_per_hour, q15_16>(36)).number() == 10);
+static_assert(quantity_cast<si::metre_per_second>(si::speed<si::kilometre_per_hour, q15_16>(100)).number().raw() ==
+              1820444);  // 27.7777... * 2^16 rounded
+static_assert(quantity_cast<si::length<si::millimetre, q31_32>>(si::length<si::metre, q7_8>(q7_8(-0.5)))
+                .number() == q31_32(-500));
+static_assert(quantity_cast<si::length<si::metre, q7_8>>(si::length<si::millimetre, q31_32>(q31_32(-500.25)))
+                .number() == q7_8::from_raw(-128));
+static_assert(quantity_cast<si::length<si::metre, q31_32>>(si::length<si::nanometre, q31_32>(q31_32(1e9)))
+                .number() == q31_32(1));
+static_assert(quantity_cast<degree>(angle<radian, q15_16>(q15_16(1))).number().raw() == 3754936);  // 57.2957...
+
+// quantity_cast from and to the other representations
+static_assert(quantity_cast<si::length<si::metre, q15_16>>(si::length<si::millimetre, int>(2500)).number() ==
+              q15_16(2.5));
+static_assert(quantity_cast<si::length<si::millimetre, int>>(si::length<si::metre, q15_16>(q15_16(2.5))).number() ==
+              2500);
+static_assert(quantity_cast<si::length<si::metre, q15_16>>(si::length<si::millimetre>(2500.)).number() ==
+              q15_16(2.5));
+static_assert(quantity_cast<si::length<si::millimetre>>(si::length<si::metre, q15_16>(q15_16(2.5))).number() ==
+              2500.);
+static_assert(quantity_cast<double>(si::length<si::metre, q15_16>(q15_16(2.5))).number() == 2.5);
+
+}  // namespace
@@ -21,6 +21,8 @@
 // SOFTWARE.
 
 #include "test_tools.h"
+#include <units/generic/angle.h>
+#include <units/generic/dimensionless.h>
 #include <units/isq/si/area.h>
 #include <units/isq/si/international/area.h>
 #include <units/isq/si/international/length.h>
@@ -57,6 +59,49 @@ static_assert(compare<decltype(pow<1, 4>(4_q_m2)), decltype(sqrt(2_q_m))>);
 static_assert(compare<decltype(pow<1, 4>(4_q_km2)), decltype(sqrt(2_q_km))>);
 static_assert(compare<decltype(pow<1, 4>(4_q_ft2)), decltype(sqrt(2_q_ft))>);
 
+// integral exponents
+static_assert(pow<0>(2_q_m) == 1);
+static_assert(pow<1>(2_q_m) == 2_q_m);
+static_assert(pow<2>(2_q_m) == 4_q_m2);
+static_assert(pow<3>(2_q_km) == 8_q_km3);
+static_assert(pow<4, 2>(3_q_m) == 9_q_m2);
+static_assert(pow<7>(3_q_m).number() == 2187);
+static_assert(pow<13>(3_q_m).number() == 1'594'323);
+static_assert(pow<3>(1.5_q_m) == 3.375_q_m3);
+static_assert(pow<-2>(2._q_m).number() == 0.25);
+static_assert(pow<1, 2>(16._q_m2) == 4._q_m);
+
+// compile-time evaluation of the cmath functions
+static_assert(sqrt(4._q_m2) == 2._q_m);
+static_assert(sqrt(4_q_m2) == 2_q_m);
+static_assert(cbrt(27._q_m3) == 3._q_m);
+static_assert(abs(-2._q_m) == 2._q_m);
+static_assert(abs(-2_q_m) == 2_q_m);
+static_assert(hypot(3._q_m, 4._q_m) == 5._q_m);
+static_assert(hypot(3._q_m, 400._q_cm) == 5._q_m);
+static_assert(norm(3._q_m, 4._q_m) == 5._q_m);
+static_assert(norm(1._q_m, 200._q_cm, 2._q_m, 4000._q_mm) == 5._q_m);
+static_assert(compare<decltype(norm(1._q_m, 2._q_cm, 3._q_km)), decltype(1._q_cm)>);
+
+// the sum of the squares of integral numbers could overflow
+template<typename... Qs>
+concept norm_available = requires(Qs... qs) { norm(qs...); };
+static_assert(norm_available<decltype(3._q_m), decltype(4_q_m)>);
+static_assert(!norm_available<decltype(3_q_m), decltype(4_q_m)>);
+static_assert(!norm_available<decltype(3_q_m)>);
+
+static_assert(exp(dimensionless<one, double>(0.)) == 1);
+static_assert(sin(angle<radian, double>(0.)) == 0);
+static_assert(cos(angle<radian, double>(0.)) == 1);
+static_assert(tan(angle<radian, double>(0.)) == 0);
+static_assert(sin(angle<radian, double>(1.)) > 0.84147 && sin(angle<radian, double>(1.)) < 0.84148);
+static_assert(sincos(angle<radian, double>(0.)).first == 0 && sincos(angle<radian, double>(0.)).second == 1);
+static_assert(sincos(angle<radian, double>(1.)).first == sin(angle<radian, double>(1.)));
+static_assert(sincos(angle<radian, double>(1.)).second == cos(angle<radian, double>(1.)));
+static_assert(compare<decltype(atan2(1._q_m, 1._q_km)), angle<radian, long double>>);
+static_assert(quantity_cast<decltype(sqrt(1._q_m))>(sqrt(1._q_km)).number() > 31.6227766016837 &&
+              quantity_cast<decltype(sqrt(1._q_m))>(sqrt(1._q_km)).number() < 31.6227766016838);
+
 #if __cpp_lib_constexpr_cmath
 // floor
 // integral types
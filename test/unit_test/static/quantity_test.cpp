@@ -881,6 +881,40 @@ static_assert(quantity_cast<dim_length>(1 * cgs_cm) == 1 * cm);
 static_assert(is_same_v<decltype(quantity_cast<litre>(2_q_dm3)), volume<litre, std::int64_t>>);
 static_assert(!is_same_v<decltype(quantity_cast<litre>(2_q_dm3)), volume<cubic_decimetre, std::int64_t>>);
 
+static_assert(quantity_cast<nanosecond>(si::time<second, std::int32_t>(3), overflow::saturating).number() ==
+              std::numeric_limits<std::int32_t>::max());
+static_assert(quantity_cast<nanosecond>(si::time<second, std::int32_t>(-3), overflow::saturating).number() ==
+              std::numeric_limits<std::int32_t>::min());
+static_assert(quantity_cast<nanosecond>(si::time<second, std::int32_t>(3), overflow::wrapping).number() ==
+              -1'294'967'296);
+static_assert(quantity_cast<nanosecond>(si::time<second, std::int32_t>(1), overflow::checked).number() ==
+              1'000'000'000);
+static_assert(
+  quantity_cast<si::time<nanosecond, std::int64_t>>(si::time<second, std::int32_t>(3), overflow::checked).number() ==
+  3'000'000'000);
+static_assert(quantity_cast<kilometre>(length<metre, std::int64_t>(-1999), overflow::checked).number() == -1);
+static_assert(quantity_cast<dim_length, kilometre>(length<metre, std::int64_t>(1999), overflow::checked).number() == 1);
+static_assert(quantity_cast<std::uint16_t>(length<metre, int>(-1), overflow::saturating).number() == 0);
+static_assert(quantity_cast<std::uint16_t>(length<metre, int>(-1), overflow::wrapping).number() == 65535);
+static_assert(quantity_cast<std::int64_t>(length<metre, std::int8_t>(-128), overflow::checked).number() == -128);
+static_assert(quantity_cast<length<metre, std::int64_t>>(fps::length<fps::mile, std::int64_t>(1'000'000'000'000'000),
+                                                         overflow::checked)
+                .number() == 1'609'344'000'000'000'000);
+static_assert(!detail::may_overflow<std::int64_t, mag<1000>(), std::int32_t>);
+static_assert(detail::may_overflow<std::int64_t, mag<1000>(), std::int64_t>);
+static_assert(!detail::may_overflow<std::int8_t, mag<1>() / mag<1000>(), std::int16_t>);
+
+static_assert(quantity_cast<metre>(-1500_q_mm, rounding::toward_zero).number() == -1);
+static_assert(quantity_cast<metre>(-1500_q_mm, rounding::floor).number() == -2);
+static_assert(quantity_cast<metre>(-1500_q_mm, rounding::ceil).number() == -1);
+static_assert(quantity_cast<metre>(-1500_q_mm, rounding::half_to_even).number() == -2);
+static_assert(quantity_cast<metre>(-2500_q_mm, rounding::half_to_even).number() == -2);
+static_assert(quantity_cast<metre>(-2500_q_mm, rounding::half_away_from_zero).number() == -3);
+static_assert(quantity_cast<metre>(2499_q_mm, rounding::half_away_from_zero).number() == 2);
+static_assert(quantity_cast<length<metre, unsigned>>(2500_q_mm, rounding::half_to_even).number() == 2);
+static_assert(quantity_cast<dim_length, kilometre>(1001_q_m, rounding::ceil).number() == 2);
+static_assert(quantity_cast<millimetre>(2_q_m, rounding::floor).number() == 2000);
+
 ////////////////
 // downcasting
 ////////////////
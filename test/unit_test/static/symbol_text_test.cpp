@@ -20,6 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <units/bits/external/text_tools.h>
 #include <units/symbol_text.h>
 
 using namespace units;
@@ -92,4 +93,11 @@ static_assert(sym6 + basic_fixed_string("f") == basic_symbol_text("bcf", "def"))
 static_assert("a" + sym6 == basic_symbol_text("abc", "ade"));
 static_assert(sym6 + "f" == basic_symbol_text("bcf", "def"));
 
+static_assert(detail::symbol_text_join() == basic_symbol_text(""));
+static_assert(detail::symbol_text_join(sym4) == basic_symbol_text("bc"));
+static_assert(detail::symbol_text_join(basic_fixed_string("a"), sym6, basic_fixed_string("f")) ==
+              basic_symbol_text("abcf", "adef"));
+static_assert(detail::symbol_text_join(sym6, basic_symbol_text("a", "f"), sym4) ==
+              basic_symbol_text("bcabc", "defbc"));
+
 }  // namespace